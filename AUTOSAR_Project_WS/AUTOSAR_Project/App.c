@@ -16,50 +16,259 @@
 
 #include "App.h"
 #include "Button.h"
+#include "Keypad.h"
 #include "Led.h"
 #include "Dio.h"
 #include "Mcu.h"
 #include "Port.h"
+#include "Gpt.h"
+#include "Dma.h"
+#include "Pwm.h"
+#include "Display.h"
+#include "Latency.h"
+#include "Hsm.h"
+#include "Det.h"
+
+/*
+ * Application state machine: SW1 presses toggle LED1 in the NORMAL state, a long press of SW1 locks and
+ * unlocks the switch, and the newly pressed keypad keys are shown on the first digit while unlocked.
+ *
+ *   ACTIVE                      DOUBLE_CLICK(SW1) / clear the key digit
+ *   +-- NORMAL (initial)        PRESSED(SW1) / toggle LED1, KEY / show the key, LONG_PRESS(SW1) --> LOCKED
+ *   +-- LOCKED                  LONG_PRESS(SW1) --> NORMAL
+ */
+#define APP_STATE_ACTIVE               (Hsm_StateIdType)0x00
+#define APP_STATE_NORMAL               (Hsm_StateIdType)0x01
+#define APP_STATE_LOCKED               (Hsm_StateIdType)0x02
+#define APP_STATES                     (3U)
+
+/* The button events (BUTTON_EVENT_x, with the button id as data) then a keypad key press (the key id as data) */
+#define APP_EVENT_KEY                  (Hsm_EventIdType)0x05
+#define APP_EVENTS                     (6U)
+
+/*
+ * Worst case of the events queued between two App_Task runs (every 60 Mili-seconds): all the keypad keys newly
+ * pressed at each of the 3 Button_Task scans (every 20 Mili-seconds) and the full button events queue
+ */
+#define APP_EVENT_WORST_CASE           ((3U * KEYPAD_ROWS * KEYPAD_COLUMNS) + (BUTTON_EVENT_QUEUE_SIZE - 1U))
+
+/* Size of the event queue of the machine (a power of 2), one entry is kept free */
+#define APP_EVENT_QUEUE_SIZE           (64U)
+
+STATIC_ASSERT((APP_EVENT_QUEUE_SIZE - 1U) >= APP_EVENT_WORST_CASE, App_EventQueueTooSmall);
+
+/* Digit of the keypad keys and digit of the lock indicator */
+#define APP_KEY_DIGIT                  (0U)
+#define APP_LOCK_DIGIT                 (DISPLAY_DIGITS - 1U)
+
+/* SW1 presses toggle LED1, read by the hybrid debounce notification from the interrupts */
+static volatile boolean App_PressEnabled = FALSE;
+
+/* Guard of the SW1 transitions */
+static boolean App_IsSw1(const Hsm_EventType * EventPtr)
+{
+    return (ButtonConf_SW1_BUTTON_ID_INDEX == EventPtr->Data) ? TRUE : FALSE;
+}
+
+/* Entry and exit actions of NORMAL */
+static void App_EnterNormal(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+    App_PressEnabled = TRUE;
+}
+
+static void App_ExitNormal(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+    App_PressEnabled = FALSE;
+}
+
+/* Entry and exit actions of LOCKED, an 'L' on the last digit */
+static void App_EnterLocked(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+    Display_SetSegments(APP_LOCK_DIGIT,(uint8)(DISPLAY_SEGMENT_D | DISPLAY_SEGMENT_E | DISPLAY_SEGMENT_F));
+}
+
+static void App_ExitLocked(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+    Display_SetSegments(APP_LOCK_DIGIT,0U);
+}
+
+/* Action of a SW1 press in NORMAL */
+static void App_ToggleLed(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+#if (BUTTON_HYBRID_DEBOUNCE == STD_OFF)
+    LATENCY_MARK_STAGE(LATENCY_STAGE_APP,Gpt_GetTimeStamp());
+    Led_Toggle();
+#else
+    /* No Action Required ... the led is toggled at once by App_ButtonPressNotification */
+#endif
+}
+
+/* Action of a key press in NORMAL */
+static void App_ShowKey(const Hsm_EventType * EventPtr)
+{
+    Display_SetDigit(APP_KEY_DIGIT,EventPtr->Data);
+}
+
+/* Action of a SW1 double click in ACTIVE */
+static void App_ClearKey(const Hsm_EventType * EventPtr)
+{
+    (void)EventPtr;
+    Display_SetSegments(APP_KEY_DIGIT,0U);
+}
+
+static const Hsm_StateType App_States[APP_STATES] = {
+    /* Parent            InitialChild       Entry            Exit */
+    { HSM_NO_STATE,      APP_STATE_NORMAL,  NULL_PTR,        NULL_PTR       },   /* ACTIVE */
+    { APP_STATE_ACTIVE,  HSM_NO_STATE,      App_EnterNormal, App_ExitNormal },   /* NORMAL */
+    { APP_STATE_ACTIVE,  HSM_NO_STATE,      App_EnterLocked, App_ExitLocked }    /* LOCKED */
+};
+
+static const Hsm_TransitionType App_Transitions[] = {
+    /* Source            Event                      Target            Guard      Action */
+    { APP_STATE_NORMAL,  BUTTON_EVENT_PRESSED,      HSM_NO_STATE,     App_IsSw1, App_ToggleLed },
+    { APP_STATE_NORMAL,  APP_EVENT_KEY,             HSM_NO_STATE,     NULL_PTR,  App_ShowKey   },
+    { APP_STATE_NORMAL,  BUTTON_EVENT_LONG_PRESS,   APP_STATE_LOCKED, App_IsSw1, NULL_PTR      },
+    { APP_STATE_LOCKED,  BUTTON_EVENT_LONG_PRESS,   APP_STATE_NORMAL, App_IsSw1, NULL_PTR      },
+    { APP_STATE_ACTIVE,  BUTTON_EVENT_DOUBLE_CLICK, HSM_NO_STATE,     App_IsSw1, App_ClearKey  }
+};
+
+static const Hsm_ConfigType App_MachineConfig = {
+    App_States, APP_STATES,
+    App_Transitions, (uint8)(sizeof(App_Transitions) / sizeof(App_Transitions[0])),
+    APP_EVENTS, APP_STATE_ACTIVE
+};
+
+/* RAM of the machine: the lookup tables precomputed by Hsm_Init and the event queue */
+static uint8 App_MachineLookup[HSM_LOOKUP_ENTRIES(APP_STATES,APP_EVENTS)];
+static uint8 App_MachineNext[sizeof(App_Transitions) / sizeof(App_Transitions[0])];
+static Hsm_EventType App_MachineQueue[APP_EVENT_QUEUE_SIZE];
+
+static Hsm_MachineType App_Machine = {
+    &App_MachineConfig, App_MachineLookup, App_MachineNext, App_MachineQueue, APP_EVENT_QUEUE_SIZE, 0U, 0U, 0U,
+    HSM_NO_STATE
+};
 
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void)
 {
+    /* Start the time stamp base used by the time stamped events and the Mcu modes residency */
+    Gpt_StartTimeBase();
+
     /* Initialize Mcu Driver */
     Mcu_Init();
 
+    /* Initialize Det, the development errors are time stamped from now on */
+    Det_Init();
+
+    /* Initialize uDMA Driver used by the Dio sequences */
+    Dma_Init();
+
     /* Initialize PORT Driver */
     Port_Init(&Port_Configuration);
 
+    /*
+     * Initialize Button Module (SW1 hybrid debounce timer) before the Dio Driver, Dio_Init enables the SW1 edge
+     * interrupt and its notification starts the debounce timer, which shall already be clocked and configured
+     */
+    Button_Init();
+
     /* Initialize Dio Driver */
     Dio_Init(&Dio_Configuration);
+
+    /* Initialize Pwm Driver, the motor, fan and heater channels start at their default duty cycles */
+    Pwm_Init(&Pwm_Configuration);
+
+    /* Initialize Display Module, the digits are refreshed by the uDMA from now on */
+    Display_Init();
+
+    /* Initialize Keypad Module (all the rows released) */
+    Keypad_Init();
+
+#if (LED_ENGINE_API == STD_ON)
+    /* Initialize the LED engine, the green LED shows a heartbeat while the tasks are running */
+    Led_Init();
+    Led_StartPattern(LedConf_GREEN_LED_ID,&Led_HeartbeatPattern);
+#endif
+
+    /* Start the application state machine in its initial state */
+    Hsm_Init(&App_Machine);
 }
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button and keypad state */
 void Button_Task(void)
 {
+    Keypad_KeyMapType presses;
+    uint8 key;
+
     Button_RefreshState();
+    Keypad_RefreshState();
+
+    /* Queue the newly pressed keys for the application state machine, in the order of their ids */
+    presses = Keypad_GetNewPresses();
+    for(key = 0; (0U != presses) && (key < (KEYPAD_ROWS * KEYPAD_COLUMNS)); key++)
+    {
+        if(presses & ((Keypad_KeyMapType)1U << key))
+        {
+            (void)Hsm_PostEvent(&App_Machine,APP_EVENT_KEY,key);
+            presses &= ~((Keypad_KeyMapType)1U << key);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
 }
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void)
 {
+#if (LED_ENGINE_API == STD_ON)
+    Led_MainFunction();
+#endif
     Led_RefreshOutput();
 }
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds to dispatch the button and keypad events to the application state machine */
 void App_Task(void)
 {
-    static uint8 button_previous_state = BUTTON_RELEASED;
-    static uint8 button_current_state  = BUTTON_RELEASED;
-
-    button_current_state = Button_GetState(); /* Read the button state */
+    Button_EventType event;
 
-    /* Only Toggle the led in case the current state of the switch is pressed
-     * and the previous state is released */ 
-    if((button_current_state == BUTTON_PRESSED) && (button_previous_state == BUTTON_RELEASED))
+    /* The button events join the keypad events in the queue of the machine, then all are dispatched in order */
+    while(TRUE == Button_GetEvent(&event))
     {
-        Led_Toggle();
+        if(FALSE == Hsm_PostEvent(&App_Machine,event.Event,event.ButtonId))
+        {
+            /* The queue is full, the queued events are dispatched first so the dequeued button event is not lost */
+            Hsm_MainFunction(&App_Machine);
+            (void)Hsm_PostEvent(&App_Machine,event.Event,event.ButtonId);
+        }
+        else
+        {
+            /* No Action Required */
+        }
     }
+    Hsm_MainFunction(&App_Machine);
+}
+
+/* Description: SW1 press notification of the hybrid debounce, called from the interrupts to toggle the led at once */
+void App_ButtonPressNotification(uint8 ButtonId, uint32 TimeStamp)
+{
+    (void)ButtonId;
+    (void)TimeStamp;
 
-    button_previous_state = button_current_state;
+    /* The press is acted on at once, its event is dispatched later by App_Task for the state changes */
+    if(TRUE == App_PressEnabled)
+    {
+        LATENCY_MARK_STAGE(LATENCY_STAGE_APP,Gpt_GetTimeStamp());
+        Led_ToggleNow();
+    }
+    else
+    {
+        /* No Action Required ... SW1 is locked */
+    }
 }
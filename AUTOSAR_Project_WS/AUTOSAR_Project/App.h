@@ -17,13 +17,16 @@
 /* Description: Task executes once to initialize all the Modules */
 void Init_Task(void);
 
-/* Description: Task executes every 20 Mili-seconds to check the button state */
+/* Description: Task executes every 20 Mili-seconds to check the button and keypad state */
 void Button_Task(void);
 
 /* Description: Task executes every 40 Mili-seconds to refresh the LED */
 void Led_Task(void);
 
-/* Description: Task executes every 60 Mili-seconds to get the button status and toggle the led */
+/* Description: Task executes every 60 Mili-seconds to dispatch the button and keypad events to the application state machine */
 void App_Task(void);
 
+/* Description: SW1 press notification of the hybrid debounce, called from the interrupts to toggle the led at once */
+void App_ButtonPressNotification(uint8 ButtonId, uint32 TimeStamp);
+
 #endif /* APP_H_ */
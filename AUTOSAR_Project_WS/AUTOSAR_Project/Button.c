@@ -14,50 +14,367 @@
  ******************************************************************************/
 
 #include "Dio.h"
+#include "Gpt.h"
 #include "Button.h"
+#include "Latency.h"
 
-/* Global variable to hold the button state */
-static uint8 g_button_state = BUTTON_RELEASED;
+#if (BUTTON_HYBRID_DEBOUNCE == STD_ON)
+/* Press notification of the application */
+#include "App.h"
+#endif
+
+/* The debounce threshold of each group shall be 1 --> 7 samples (3-bit vertical counter) */
+#define BUTTON_CHECK_GROUP_THRESHOLD(NAME,PORT,MASK,THRESHOLD) \
+    STATIC_ASSERT(((THRESHOLD) >= 1U) && ((THRESHOLD) <= 7U), Button_##NAME##_GroupThresholdOutOfRange);
+
+BUTTON_CONFIGURED_GROUPS_LIST(BUTTON_CHECK_GROUP_THRESHOLD)
+
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+/* The group pins latched in the process image at the start of this Os tick, the tasks of the tick see the same levels */
+#define BUTTON_READ_PORT(PORT)         Dio_ReadPortImage(PORT)
+#else
+/* One load of the whole port */
+#define BUTTON_READ_PORT(PORT)         Dio_ReadPort(PORT)
+#endif
+
+/* The queue indexes are wrapped with a mask */
+#if ((BUTTON_EVENT_QUEUE_SIZE & (BUTTON_EVENT_QUEUE_SIZE - 1U)) != 0U) || (BUTTON_EVENT_QUEUE_SIZE > 128U)
+  #error "BUTTON_EVENT_QUEUE_SIZE shall be a power of 2 up to 128"
+#endif
+
+/* Configuration of one debounce group */
+typedef struct
+{
+    Dio_PortType Port;
+    uint8 Mask;
+    uint8 Threshold;
+} Button_GroupConfigType;
+
+/*
+ * Vertical counter of one debounce group: bit n of Count0/Count1/Count2 are the 3 bits of the counter of pin n,
+ * which counts the consecutive samples different from the debounced state of the pin.
+ */
+typedef struct
+{
+    uint8 State;
+    uint8 Count0;
+    uint8 Count1;
+    uint8 Count2;
+} Button_GroupStateType;
+
+#define BUTTON_GROUP_CONFIG(NAME,PORT,MASK,THRESHOLD)  {PORT, MASK, THRESHOLD},
+
+static const Button_GroupConfigType Button_Groups[BUTTON_CONFIGURED_GROUPS] = {
+    BUTTON_CONFIGURED_GROUPS_LIST(BUTTON_GROUP_CONFIG)
+};
+
+/* Debounced state of all the pins starts released (STD_HIGH) with the counters cleared */
+#define BUTTON_GROUP_INITIAL_STATE(NAME,PORT,MASK,THRESHOLD)  {0xFF, 0, 0, 0},
+
+static Button_GroupStateType Button_GroupState[BUTTON_CONFIGURED_GROUPS] = {
+    BUTTON_CONFIGURED_GROUPS_LIST(BUTTON_GROUP_INITIAL_STATE)
+};
+
+/* Configuration of one button: its debounce group and its pin in the group port */
+typedef struct
+{
+    uint8 Group;
+    uint8 Bit;
+} Button_ButtonConfigType;
+
+/* Timing of the events of one button */
+typedef struct
+{
+    /* Time since the press while pressed, else time since the release (saturated) */
+    uint16 Time;
+    /* Hold time of the next long press or auto repeat event */
+    uint16 NextHoldEvent;
+    /* TRUE after the release of a short press which is not the second press of a double click */
+    boolean Clicked;
+    /* TRUE while the second press of a double click is held */
+    boolean SecondClick;
+} Button_ButtonStateType;
+
+#define BUTTON_BUTTON_CONFIG(NAME,GROUP,PIN)  {GROUP, (uint8)(1U << (PIN))},
+
+static const Button_ButtonConfigType Button_Buttons[BUTTON_CONFIGURED_BUTTONS] = {
+    BUTTON_CONFIGURED_BUTTONS_LIST(BUTTON_BUTTON_CONFIG)
+};
+
+static Button_ButtonStateType Button_ButtonState[BUTTON_CONFIGURED_BUTTONS];
+
+/* Button events queue: written by Button_RefreshState and read by Button_GetEvent, both called from the tasks */
+static Button_EventType Button_EventQueue[BUTTON_EVENT_QUEUE_SIZE];
+static uint8 Button_EventQueueHead = 0;
+static uint8 Button_EventQueueTail = 0;
+
+/* Number of the button events lost because the queue was full */
+static uint32 Button_EventOverflowCount = 0;
+
+#if (BUTTON_HYBRID_DEBOUNCE == STD_ON)
+/* Lockout time of the hybrid debounce in Gpt counts */
+#define BUTTON_HYBRID_LOCKOUT_COUNTS   (BUTTON_HYBRID_LOCKOUT_TIME_US * GPT_TIMESTAMP_TICKS_PER_US)
+
+/* SW1 level read directly from the pin in the interrupts (not from the Dio process image) */
+#if (DIO_PRE_COMPILE_CHANNELS_API == STD_ON)
+#define BUTTON_READ_SW1_NOW()          Dio_Read_SW1()
+#else
+#define BUTTON_READ_SW1_NOW()          Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX)
+#endif
+
+/*
+ * Last SW1 level reported by the hybrid debounce and the lockout state. They are only accessed by the
+ * GPIO PORTF and Timer2A interrupts, which have the same group priority and never preempt each other.
+ */
+static uint8 Button_HybridLevel = BUTTON_RELEASED;
+static boolean Button_HybridLockout = FALSE;
+
+/* Function to report a new SW1 level and start the lockout */
+static void Button_HybridReport(uint8 Level, uint32 TimeStamp)
+{
+    Button_HybridLevel   = Level;
+    Button_HybridLockout = TRUE;
+    Gpt_StartOneShot(BUTTON_HYBRID_LOCKOUT_COUNTS);
+
+    if(BUTTON_PRESSED == Level)
+    {
+        LATENCY_MARK_STAGE(LATENCY_STAGE_DEBOUNCED,TimeStamp);
+        BUTTON_PRESS_NOTIFICATION(ButtonConf_SW1_BUTTON_ID_INDEX,TimeStamp);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Function called from the Timer2A interrupt at the end of the lockout */
+static void Button_HybridLockoutExpired(void)
+{
+    uint8 level = BUTTON_READ_SW1_NOW();
+
+    if(level != Button_HybridLevel)
+    {
+        /* The level changed during the lockout and is reported now (a short press released, or a glitch) */
+        Button_HybridReport(level,Gpt_GetTimeStamp());
+    }
+    else
+    {
+        Button_HybridLockout = FALSE;
+    }
+}
+#endif
+
+/* Select the counter bit when the threshold bit is set, else its complement */
+#define BUTTON_MATCH_BIT(COUNT,THRESHOLD,BIT)  ((((THRESHOLD) >> (BIT)) & 1U) ? (COUNT) : (uint8)(~(COUNT)))
+
+/*
+ * Function to debounce the 8 pins of a group with one sample: the counter of each pin different from its
+ * debounced state is incremented, the others are cleared, and the pins whose counter reaches the threshold
+ * change their debounced state. The cost does not depend on the number of pins.
+ */
+static uint8 Button_DebounceGroup(Button_GroupStateType * Group, uint8 Sample, uint8 Threshold)
+{
+    uint8 delta = (uint8)(Sample ^ Group->State);
+    uint8 count0 = Group->Count0;
+    uint8 count1 = Group->Count1;
+    uint8 reached;
+
+    /* 3 bits ripple increment of all the counters, then clear the counters of the stable pins */
+    Group->Count2 = (uint8)((Group->Count2 ^ (count1 & count0)) & delta);
+    Group->Count1 = (uint8)((count1 ^ count0) & delta);
+    Group->Count0 = (uint8)(~count0 & delta);
+
+    /* Pins whose counter equals the threshold */
+    reached = (uint8)(BUTTON_MATCH_BIT(Group->Count0,Threshold,0)
+                    & BUTTON_MATCH_BIT(Group->Count1,Threshold,1)
+                    & BUTTON_MATCH_BIT(Group->Count2,Threshold,2)
+                    & delta);
+
+    Group->State  ^= reached;
+    Group->Count0 &= (uint8)(~reached);
+    Group->Count1 &= (uint8)(~reached);
+    Group->Count2 &= (uint8)(~reached);
+
+    /* Pins which changed their debounced state */
+    return reached;
+}
+
+/* Function to queue one button event */
+static void Button_QueueEvent(uint8 ButtonId, uint8 Event, uint32 TimeStamp)
+{
+    uint8 next = (uint8)((Button_EventQueueHead + 1U) & (BUTTON_EVENT_QUEUE_SIZE - 1U));
+
+    if(next != Button_EventQueueTail)
+    {
+        Button_EventQueue[Button_EventQueueHead].ButtonId  = ButtonId;
+        Button_EventQueue[Button_EventQueueHead].Event     = Event;
+        Button_EventQueue[Button_EventQueueHead].TimeStamp = TimeStamp;
+        Button_EventQueueHead = next;
+    }
+    else
+    {
+        Button_EventOverflowCount++;
+    }
+}
+
+/* Function to detect the events of one button after the debounce of its group */
+static void Button_UpdateEvents(uint8 ButtonId, uint8 Changed, uint32 TimeStamp)
+{
+    const Button_ButtonConfigType * Config = &Button_Buttons[ButtonId];
+    Button_ButtonStateType * Button = &Button_ButtonState[ButtonId];
+    uint8 level = (Button_GroupState[Config->Group].State & Config->Bit) ? STD_HIGH : STD_LOW;
+
+    if(Changed & Config->Bit)
+    {
+        if(BUTTON_PRESSED == level)
+        {
+            Button_QueueEvent(ButtonId,BUTTON_EVENT_PRESSED,TimeStamp);
+#if (BUTTON_HYBRID_DEBOUNCE == STD_OFF)
+            if(ButtonConf_SW1_BUTTON_ID_INDEX == ButtonId)
+            {
+                LATENCY_MARK_STAGE(LATENCY_STAGE_DEBOUNCED,TimeStamp);
+            }
+#endif
+            if((TRUE == Button->Clicked) && (Button->Time <= BUTTON_DOUBLE_CLICK_TIME_MS))
+            {
+                Button_QueueEvent(ButtonId,BUTTON_EVENT_DOUBLE_CLICK,TimeStamp);
+                /* The release of this second press does not start another double click */
+                Button->SecondClick = TRUE;
+            }
+            else
+            {
+                Button->SecondClick = FALSE;
+            }
+            Button->Clicked       = FALSE;
+            Button->NextHoldEvent = BUTTON_LONG_PRESS_TIME_MS;
+        }
+        else
+        {
+            Button_QueueEvent(ButtonId,BUTTON_EVENT_RELEASED,TimeStamp);
+            /* A short press which is not the end of a double click may be the first click of a double click */
+            Button->Clicked = ((FALSE == Button->SecondClick) && (Button->NextHoldEvent == BUTTON_LONG_PRESS_TIME_MS)) ?
+                              TRUE : FALSE;
+        }
+        Button->Time = 0;
+    }
+    else if(BUTTON_PRESSED == level)
+    {
+        Button->Time += BUTTON_REFRESH_PERIOD_MS;
+        if(Button->Time >= Button->NextHoldEvent)
+        {
+            Button_QueueEvent(ButtonId,
+                              (Button->NextHoldEvent == BUTTON_LONG_PRESS_TIME_MS) ?
+                              BUTTON_EVENT_LONG_PRESS : BUTTON_EVENT_REPEAT,
+                              TimeStamp);
+            /* Restart the hold time at each auto repeat, so the counters never overflow */
+            Button->Time          = BUTTON_LONG_PRESS_TIME_MS;
+            Button->NextHoldEvent = BUTTON_LONG_PRESS_TIME_MS + BUTTON_REPEAT_PERIOD_MS;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else if(Button->Time <= BUTTON_DOUBLE_CLICK_TIME_MS)
+    {
+        Button->Time += BUTTON_REFRESH_PERIOD_MS;
+    }
+    else
+    {
+        /* No Action Required ... released for longer than the double click time */
+    }
+}
 
 /*******************************************************************************************************************/
-uint8 Button_GetState(void)
+void Button_Init(void)
 {
-    return g_button_state;
+#if (BUTTON_HYBRID_DEBOUNCE == STD_ON)
+    Gpt_InitOneShot(Button_HybridLockoutExpired);
+#endif
 }
 
 /*******************************************************************************************************************/
-void Button_RefreshState(void)
+void Button_EdgeNotification(uint8 ChannelId, uint8 Level, uint32 TimeStamp)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    (void)ChannelId;
+
+#if (BUTTON_HYBRID_DEBOUNCE == STD_ON)
+    if((FALSE == Button_HybridLockout) && (Level != Button_HybridLevel))
+    {
+        /* First edge after a stable period ... acted on immediately */
+        Button_HybridReport(Level,TimeStamp);
+    }
+    else
+    {
+        /* No Action Required ... a bounce during the lockout */
+    }
+#else
+    (void)Level;
+    (void)TimeStamp;
+#endif
+}
 
-    /* Count the number of Pressed times increment if the switch pressed for 20 ms */
-    static uint8 g_Pressed_Count  = 0;
+/*******************************************************************************************************************/
+uint8 Button_GetState(void)
+{
+    /* The button level is the debounced level of SW1 (BUTTON_PRESSED is STD_LOW) */
+    return (Button_GroupState[ButtonConf_SW_GROUP_ID_INDEX].State & (1U << BUTTON_PIN_NUM)) ? STD_HIGH : STD_LOW;
+}
 
-    /* Count the number of Released times increment if the switch released for 20 ms */
-    static uint8 g_Released_Count = 0;
+/*******************************************************************************************************************/
+uint8 Button_GetGroupState(uint8 GroupId)
+{
+    uint8 state = 0;
 
-    if(state == BUTTON_PRESSED)
+    if(GroupId < BUTTON_CONFIGURED_GROUPS)
     {
-        g_Pressed_Count++;
-        g_Released_Count = 0;
+        state = (uint8)(Button_GroupState[GroupId].State & Button_Groups[GroupId].Mask);
     }
     else
     {
-        g_Released_Count++;
-        g_Pressed_Count = 0;
+        /* No Action Required */
+    }
+    return state;
+}
+
+/*******************************************************************************************************************/
+void Button_RefreshState(void)
+{
+    uint8 changed[BUTTON_CONFIGURED_GROUPS];
+    uint32 timestamp = Gpt_GetTimeStamp();
+    uint8 group;
+    uint8 button;
+
+    for(group = 0; group < BUTTON_CONFIGURED_GROUPS; group++)
+    {
+        /* The pins out of the group are kept released */
+        uint8 sample = (uint8)((BUTTON_READ_PORT(Button_Groups[group].Port) & Button_Groups[group].Mask)
+                             | (uint8)(~Button_Groups[group].Mask));
+
+        changed[group] = Button_DebounceGroup(&Button_GroupState[group],sample,Button_Groups[group].Threshold);
     }
 
-    if(g_Pressed_Count == 3)
+    for(button = 0; button < BUTTON_CONFIGURED_BUTTONS; button++)
     {
-        g_button_state = BUTTON_PRESSED;
-        g_Pressed_Count       = 0;
-        g_Released_Count      = 0;
+        Button_UpdateEvents(button,changed[Button_Buttons[button].Group],timestamp);
     }
-    else if(g_Released_Count == 3)
+}
+
+/*******************************************************************************************************************/
+boolean Button_GetEvent(Button_EventType * EventPtr)
+{
+    boolean available = FALSE;
+
+    if((NULL_PTR != EventPtr) && (Button_EventQueueTail != Button_EventQueueHead))
+    {
+        *EventPtr = Button_EventQueue[Button_EventQueueTail];
+        Button_EventQueueTail = (uint8)((Button_EventQueueTail + 1U) & (BUTTON_EVENT_QUEUE_SIZE - 1U));
+        available = TRUE;
+    }
+    else
     {
-        g_button_state = BUTTON_RELEASED;
-        g_Released_Count      = 0;
-        g_Pressed_Count       = 0;
+        /* No Action Required ... no pending events */
     }
+    return available;
 }
 /*******************************************************************************************************************/
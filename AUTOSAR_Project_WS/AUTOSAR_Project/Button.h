@@ -14,14 +14,51 @@
 #include "Std_Types.h"
 #include "Button_Cfg.h"
 
+/* Button events */
+#define BUTTON_EVENT_PRESSED           (uint8)0x00
+#define BUTTON_EVENT_RELEASED          (uint8)0x01
+#define BUTTON_EVENT_LONG_PRESS        (uint8)0x02   /* Held for BUTTON_LONG_PRESS_TIME_MS */
+#define BUTTON_EVENT_REPEAT            (uint8)0x03   /* Still held, every BUTTON_REPEAT_PERIOD_MS after the long press */
+#define BUTTON_EVENT_DOUBLE_CLICK      (uint8)0x04   /* Second press after a short click, follows its PRESSED event */
+
+/* Structure for one button event */
+typedef struct
+{
+    /* Member contains the index of the button in the buttons table */
+    uint8 ButtonId;
+    /* Member contains the event */
+    uint8 Event;
+    /* Member contains the Gpt time stamp of the sample which detected the event */
+    uint32 TimeStamp;
+} Button_EventType;
+
+/* Description: Start the one-shot timer of the SW1 hybrid debounce, called once after Dio_Init */
+void Button_Init(void);
+
 /* Description: Read the Button state Pressed/Released */
 uint8 Button_GetState(void);
 
+/* Description: Read the debounced levels of the pins of a debounce group (bit n --> pin n of the group port) */
+uint8 Button_GetGroupState(uint8 GroupId);
+
 /* 
  * Description: This function is called every 20ms by Os Task and it responsible for Updating 
  *              the BUTTON State. it should be in a PRESSED State if the button is pressed for 60ms.
  *		        and it should be in a RELEASED State if the button is released for 60ms.
+ *              All the pins of each debounce group are debounced together with a few bitwise operations.
  */   
 void Button_RefreshState(void);
 
+/*
+ * Description: Get the oldest queued button event, returns FALSE if the queue is empty.
+ *              Each event is returned once, the events are queued by Button_RefreshState.
+ */
+boolean Button_GetEvent(Button_EventType * EventPtr);
+
+/*
+ * Description: Dio edge notification of SW1 (DioConf_SW1_NOTIFICATION), called from the port interrupt
+ *              with the level after the edge and the time stamp of the interrupt.
+ */
+void Button_EdgeNotification(uint8 ChannelId, uint8 Level, uint32 TimeStamp);
+
 #endif /* BUTTON_H */
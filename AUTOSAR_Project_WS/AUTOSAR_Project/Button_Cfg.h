@@ -22,5 +22,61 @@
 /* Set the Button Pin Number */
 #define BUTTON_PIN_NUM DioConf_SW1_CHANNEL_NUM
 
+/*
+ * Debounce groups: the masked pins of one port are debounced together by a vertical counter, a pin changes
+ * its debounced state after THRESHOLD consecutive samples (1 --> 7) at the new level.
+ * The debounced state of all the pins starts at STD_HIGH (released with the pull up resistors).
+ * With DIO_PROCESS_IMAGE_API the groups are sampled from the process image, so their pins shall be configured Dio channels.
+ */
+#define BUTTON_CONFIGURED_GROUPS             (1U)
+
+/* Group Index in the groups table */
+#define ButtonConf_SW_GROUP_ID_INDEX         (uint8)0x00
+
+/* SW1 on PORTF Pin 4, 3 samples of 20 ms */
+#define ButtonConf_SW_GROUP_PORT             BUTTON_PORT
+#define ButtonConf_SW_GROUP_MASK             (uint8)(1U << BUTTON_PIN_NUM)
+#define ButtonConf_SW_GROUP_THRESHOLD        (3U)
+
+/* List of the debounce groups used to generate the groups table: GROUP(Name, Port, Mask, Threshold) */
+#define BUTTON_CONFIGURED_GROUPS_LIST(GROUP) \
+    GROUP(SW, ButtonConf_SW_GROUP_PORT, ButtonConf_SW_GROUP_MASK, ButtonConf_SW_GROUP_THRESHOLD)
+
+/* Number of the buttons with events, each button is one pin of a debounce group */
+#define BUTTON_CONFIGURED_BUTTONS            (1U)
+
+/* Button Index in the buttons table, used as the ButtonId of the events */
+#define ButtonConf_SW1_BUTTON_ID_INDEX       (uint8)0x00
+
+/* List of the buttons used to generate the buttons table: BUTTON(Name, Group Index, Pin) */
+#define BUTTON_CONFIGURED_BUTTONS_LIST(BUTTON) \
+    BUTTON(SW1, ButtonConf_SW_GROUP_ID_INDEX, BUTTON_PIN_NUM)
+
+/* Period of Button_RefreshState (Button_Task) */
+#define BUTTON_REFRESH_PERIOD_MS             (20U)
+
+/* Hold time of the first long press event, then period of the auto repeat events while the button is held */
+#define BUTTON_LONG_PRESS_TIME_MS            (1000U)
+#define BUTTON_REPEAT_PERIOD_MS              (200U)
+
+/* Maximum time between the release of a short press and the next press to be a double click */
+#define BUTTON_DOUBLE_CLICK_TIME_MS          (400U)
+
+/* Size of the button events queue (power of 2, up to 128) */
+#define BUTTON_EVENT_QUEUE_SIZE              (8U)
+
+/*
+ * Pre-compile option for the SW1 hybrid debounce: the first SW1 edge is reported at once from the port interrupt,
+ * a press calls BUTTON_PRESS_NOTIFICATION. The following edges (bounces) are ignored during the lockout time,
+ * at its end the pin is sampled again and a level different from the reported one is reported and starts a new
+ * lockout. A glitch shorter than the lockout is reported as a press, the price of the optimistic detection.
+ */
+#define BUTTON_HYBRID_DEBOUNCE               (STD_ON)
+
+/* Lockout time of the hybrid debounce, longer than the SW1 bounces */
+#define BUTTON_HYBRID_LOCKOUT_TIME_US        (10000U)
+
+/* Function called from the interrupts at each SW1 press detected by the hybrid debounce (ButtonId, TimeStamp) */
+#define BUTTON_PRESS_NOTIFICATION            App_ButtonPressNotification
 
 #endif /* BUTTON_CFG_H_ */
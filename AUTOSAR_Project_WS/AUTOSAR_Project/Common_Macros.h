@@ -37,4 +37,39 @@
 /* Macro to get value of a specific bit */
 #define GET_BIT(REG,BIT) ( ( REG & (1<<BIT) ) >> BIT )
 
+/*
+ * Bit-band access of a single bit ... the Cortex-M4 maps each bit of the first 1MB of the SRAM (0x20000000)
+ * and of the Peripherals (0x40000000) regions to a word in the alias regions (0x22000000 and 0x42000000).
+ * A write to the alias word changes only its bit with an atomic bus access (no read-modify-write in the code)
+ * and a read returns the value of the bit (0 or 1). REG must be located in one of the two bit-band regions.
+ */
+#if defined(__TI_ARM__) || defined(__ARM_ARCH_7EM__)
+
+/* Alias word of a specific bit in any register or variable of the bit-band regions */
+#define BITBAND_ALIAS(REG,BIT) \
+    (*(volatile uint32 *)(((uint32)&(REG) & 0xF0000000UL) + 0x02000000UL \
+                          + (((uint32)&(REG) & 0x000FFFFFUL) << 5) + ((uint32)(BIT) << 2)))
+
+/* Set a certain bit in any register atomically */
+#define BITBAND_SET_BIT(REG,BIT) (BITBAND_ALIAS(REG,BIT) = 1U)
+
+/* Clear a certain bit in any register atomically */
+#define BITBAND_CLEAR_BIT(REG,BIT) (BITBAND_ALIAS(REG,BIT) = 0U)
+
+/* Write the least significant bit of VALUE in a certain bit of any register atomically */
+#define BITBAND_WRITE_BIT(REG,BIT,VALUE) (BITBAND_ALIAS(REG,BIT) = ((uint32)(VALUE) & 1U))
+
+/* Macro to get value of a specific bit */
+#define BITBAND_GET_BIT(REG,BIT) (BITBAND_ALIAS(REG,BIT))
+
+#else
+
+/* Host build without bit-band regions ... same semantics of the alias word emulated by a read-modify-write */
+#define BITBAND_SET_BIT(REG,BIT) SET_BIT(REG,BIT)
+#define BITBAND_CLEAR_BIT(REG,BIT) CLEAR_BIT(REG,BIT)
+#define BITBAND_WRITE_BIT(REG,BIT,VALUE) (((VALUE) & 1U) ? SET_BIT(REG,BIT) : CLEAR_BIT(REG,BIT))
+#define BITBAND_GET_BIT(REG,BIT) GET_BIT(REG,BIT)
+
+#endif
+
 #endif
@@ -51,4 +51,21 @@
 /* This is used to define the abstraction of compiler keyword static */
 #define STATIC            static
 
+/* This is used to place a time critical function in SRAM to avoid the Flash wait states,
+   the function is linked in .TI.ramfunc section and copied from Flash by the boot code */
+#define RAM_FUNC          __attribute__((ramfunc))
+
+/* This is used to fail the build if a condition on constant expressions is false, at file scope,
+   the name of the array type is reported in the compiler error */
+#define STATIC_ASSERT(COND,NAME)          typedef char NAME[(COND) ? 1 : -1]
+
+/* This is used to check if an expression is a constant known at compile time (1) or only at runtime (0) */
+#define COMPILE_TIME_CONSTANT(EXPR)       __builtin_constant_p(EXPR)
+
+/* This is used to fail the build if the condition is false while the expression is a compile-time constant,
+   the array size is selected by __builtin_choose_expr so it stays a constant (not a variable length array)
+   for an expression only known at runtime, whose condition is not evaluated */
+#define COMPILE_TIME_CHECK(EXPR,COND)     \
+    ((void)sizeof(char[__builtin_choose_expr(COMPILE_TIME_CONSTANT(EXPR), (COND) ? 1 : -1, 1)]))
+
 #endif
@@ -11,15 +11,205 @@
 
 #include "Det.h"
 
+/* Time stamp base of the recorded errors */
+#include "Gpt.h"
+
+/* The ring buffer indexes are wrapped with a mask */
+#if ((DET_ERROR_BUFFER_SIZE & (DET_ERROR_BUFFER_SIZE - 1U)) != 0U) || (DET_ERROR_BUFFER_SIZE > 128U)
+  #error "DET_ERROR_BUFFER_SIZE shall be a power of 2 up to 128"
+#endif
+
+/* Module Ids with their own counter, generated from the configured list */
+#define DET_MODULE_ENTRY(ID)           (uint16)(ID),
+STATIC const uint16 Det_Modules[] = { DET_MODULES_LIST(DET_MODULE_ENTRY) };
+#define DET_NUMBER_OF_MODULES          (sizeof(Det_Modules) / sizeof(Det_Modules[0]))
+
+/* Error hooks declarations and calls, generated from the configured list */
+#define DET_DECLARE_HOOK(NAME)         extern void NAME(const Det_ErrorType * ErrorPtr);
+#define DET_CALL_HOOK(NAME)            NAME(&error);
+DET_ERROR_HOOKS_LIST(DET_DECLARE_HOOK)
+
+/*
+ * Error ring buffer: the report number n (1, 2, ...) is written in the entry (n - 1) modulo the size, and
+ * the number is written in Det_ErrorSequence after the error itself. A reader checks the number before and
+ * after its copy, so it never returns an entry being written or overwritten.
+ */
+STATIC Det_ErrorType Det_ErrorBuffer[DET_ERROR_BUFFER_SIZE];
+STATIC volatile uint32 Det_ErrorSequence[DET_ERROR_BUFFER_SIZE];
+
+/* Number of all the reported errors, the last report number */
+STATIC volatile uint32 Det_TotalErrorCount = 0;
+
+/* Counters of the configured modules, then the counter of all the other modules */
+STATIC volatile uint32 Det_ModuleErrorCount[DET_NUMBER_OF_MODULES + 1U];
+
+STATIC boolean Det_TimeStampEnabled = FALSE;
+
+/*
+ * Function to increment a counter shared by the tasks and the interrupts without disabling the interrupts
+ * (LDREX/STREX with the compiler intrinsics).
+ * The exclusive store fails when an interrupt ran since the exclusive load (the exception entry and return
+ * clear the exclusive monitor), so the increment is done again: one retry per preempting interrupt at most.
+ */
+STATIC uint32 Det_AtomicIncrement(volatile uint32 * CounterPtr)
+{
+    uint32 value;
+
+    do
+    {
+        value = (uint32)__ldrex((void *)CounterPtr) + 1U;
+    } while(0 != __strex(value,(void *)CounterPtr));
+
+    return value;
+}
+
+/* Function to find the counter of a module, bounded by the number of the configured modules */
+STATIC uint8 Det_ModuleIndex(uint16 ModuleId)
+{
+    uint8 index = 0;
+
+    while((index < DET_NUMBER_OF_MODULES) && (Det_Modules[index] != ModuleId))
+    {
+        index++;
+    }
+    /* DET_NUMBER_OF_MODULES is the counter of the other modules */
+    return index;
+}
+
+/************************************************************************************
+* Service Name: Det_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the time stamps, called once after Gpt_StartTimeBase.
+*              The errors reported before (by Irq_Init and Irq_Register in Os_start)
+*              are kept in the buffer and the counters with a time stamp of 0.
+************************************************************************************/
+void Det_Init(void)
+{
+    /* The buffer and the counters are cleared by the startup code, so the records made before are not erased */
+    Det_TimeStampEnabled = TRUE;
+}
+
+/************************************************************************************
+* Service Name: Det_ReportError
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id of the calling module
+*                  InstanceId - Index of the instance of the module
+*                  ApiId - Service Id of the API which detected the error
+*                  ErrorId - Id of the detected development error
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - always E_OK
+* Description: Function to record a development error in the error ring buffer, count it
+*              and call the error hooks, then return to the caller. The cost is bounded
+*              and no lock is taken, so it may be called from the interrupts.
+************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId )
 {
+    Det_ErrorType error;
+    uint32 sequence;
+    uint8 entry;
+
+    error.TimeStamp  = (TRUE == Det_TimeStampEnabled) ? DET_TIMESTAMP() : 0U;
+    error.ModuleId   = ModuleId;
+    error.InstanceId = InstanceId;
+    error.ApiId      = ApiId;
+    error.ErrorId    = ErrorId;
+
+    /* The report number reserves the entry, a preempting report gets the next one */
+    sequence = Det_AtomicIncrement(&Det_TotalErrorCount);
+    entry = (uint8)((sequence - 1U) & (DET_ERROR_BUFFER_SIZE - 1U));
+
+    Det_ErrorSequence[entry] = 0;          /* The entry is being written */
+    Det_ErrorBuffer[entry]   = error;
+    Det_ErrorSequence[entry] = sequence;   /* The entry is complete */
+
+    (void)Det_AtomicIncrement(&Det_ModuleErrorCount[Det_ModuleIndex(ModuleId)]);
+
+    DET_ERROR_HOOKS_LIST(DET_CALL_HOOK)
+
+#if (DET_HALT_ON_ERROR == STD_ON)
     while(1)
     {
 
     }
+#endif
     return E_OK;
 }
 
+/************************************************************************************
+* Service Name: Det_GetError
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Age - 0 for the last reported error, 1 for the one before ...
+* Parameters (inout): None
+* Parameters (out): ErrorPtr - Copy of the recorded error
+* Return value: boolean - FALSE if the error was not reported yet or was overwritten
+* Description: Function to read one of the last DET_ERROR_BUFFER_SIZE recorded errors.
+************************************************************************************/
+boolean Det_GetError(uint8 Age, Det_ErrorType * ErrorPtr)
+{
+    uint32 total = Det_TotalErrorCount;
+    boolean valid = FALSE;
+
+    if((NULL_PTR != ErrorPtr) && (Age < DET_ERROR_BUFFER_SIZE) && (Age < total))
+    {
+        uint32 sequence = total - Age;
+        uint8 entry = (uint8)((sequence - 1U) & (DET_ERROR_BUFFER_SIZE - 1U));
+
+        if(sequence == Det_ErrorSequence[entry])
+        {
+            *ErrorPtr = Det_ErrorBuffer[entry];
+            /* The entry was not overwritten by a report during the copy */
+            valid = (sequence == Det_ErrorSequence[entry]) ? TRUE : FALSE;
+        }
+        else
+        {
+            /* No Action Required ... the entry is being written or was overwritten */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return valid;
+}
+
+/************************************************************************************
+* Service Name: Det_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id, or a module not in DET_MODULES_LIST for the
+*                             errors of all the other modules
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the errors reported by the module since the reset
+* Description: Function to read the error counter of a module.
+************************************************************************************/
+uint32 Det_GetErrorCount(uint16 ModuleId)
+{
+    return Det_ModuleErrorCount[Det_ModuleIndex(ModuleId)];
+}
+
+/************************************************************************************
+* Service Name: Det_GetTotalErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the errors reported by all the modules since the reset
+* Description: Function to read the number of all the reported errors.
+************************************************************************************/
+uint32 Det_GetTotalErrorCount(void)
+{
+    return Det_TotalErrorCount;
+}
@@ -46,12 +46,112 @@
 #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/* Det Pre-Compile Configuration Header file */
+#include "Det_Cfg.h"
+
+/* AUTOSAR Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_AR_MAJOR_VERSION != DET_AR_MAJOR_VERSION)\
+ ||  (DET_CFG_AR_MINOR_VERSION != DET_AR_MINOR_VERSION)\
+ ||  (DET_CFG_AR_PATCH_VERSION != DET_AR_PATCH_VERSION))
+  #error "The AR version of Det_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Det_Cfg.h and Det.h files */
+#if ((DET_CFG_SW_MAJOR_VERSION != DET_SW_MAJOR_VERSION)\
+ ||  (DET_CFG_SW_MINOR_VERSION != DET_SW_MINOR_VERSION)\
+ ||  (DET_CFG_SW_PATCH_VERSION != DET_SW_PATCH_VERSION))
+  #error "The SW version of Det_Cfg.h does not match the expected version"
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* One reported development error */
+typedef struct
+{
+    /* Member contains the Gpt time stamp of the report, 0 before Det_Init */
+    uint32 TimeStamp;
+    /* Member contains the parameters of Det_ReportError */
+    uint16 ModuleId;
+    uint8 InstanceId;
+    uint8 ApiId;
+    uint8 ErrorId;
+} Det_ErrorType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Det_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start the time stamps, called once after Gpt_StartTimeBase.
+*              The errors reported before (by Irq_Init and Irq_Register in Os_start)
+*              are kept in the buffer and the counters with a time stamp of 0.
+************************************************************************************/
+void Det_Init(void);
+
+/************************************************************************************
+* Service Name: Det_ReportError
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id of the calling module
+*                  InstanceId - Index of the instance of the module
+*                  ApiId - Service Id of the API which detected the error
+*                  ErrorId - Id of the detected development error
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - always E_OK
+* Description: Function to record a development error in the error ring buffer, count it
+*              and call the error hooks, then return to the caller. The cost is bounded
+*              and no lock is taken, so it may be called from the interrupts.
+************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
                                 uint8 ErrorId );
 
+/************************************************************************************
+* Service Name: Det_GetError
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Age - 0 for the last reported error, 1 for the one before ...
+* Parameters (inout): None
+* Parameters (out): ErrorPtr - Copy of the recorded error
+* Return value: boolean - FALSE if the error was not reported yet or was overwritten
+* Description: Function to read one of the last DET_ERROR_BUFFER_SIZE recorded errors.
+************************************************************************************/
+boolean Det_GetError(uint8 Age, Det_ErrorType * ErrorPtr);
+
+/************************************************************************************
+* Service Name: Det_GetErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ModuleId - Module Id, or a module not in DET_MODULES_LIST for the
+*                             errors of all the other modules
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the errors reported by the module since the reset
+* Description: Function to read the error counter of a module.
+************************************************************************************/
+uint32 Det_GetErrorCount(uint16 ModuleId);
+
+/************************************************************************************
+* Service Name: Det_GetTotalErrorCount
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Number of the errors reported by all the modules since the reset
+* Description: Function to read the number of all the reported errors.
+************************************************************************************/
+uint32 Det_GetTotalErrorCount(void);
+
 #endif /* DET_H */
@@ -0,0 +1,59 @@
+ /******************************************************************************
+ *
+ * Module: Det
+ *
+ * File Name: Det_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for Det
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef DET_CFG_H
+#define DET_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DET_CFG_SW_MAJOR_VERSION              (1U)
+#define DET_CFG_SW_MINOR_VERSION              (0U)
+#define DET_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DET_CFG_AR_MAJOR_VERSION              (4U)
+#define DET_CFG_AR_MINOR_VERSION              (0U)
+#define DET_CFG_AR_PATCH_VERSION              (3U)
+
+/* Number of the last reported errors kept in the error ring buffer (a power of 2), the oldest are overwritten */
+#define DET_ERROR_BUFFER_SIZE                 (16U)
+
+/*
+ * Modules with their own error counter (AUTOSAR Module Ids): Dio, Pwm, Port, Irq and Dma.
+ * The errors of the other modules are counted together.
+ */
+#define DET_MODULES_LIST(MODULE) \
+    MODULE(120U) \
+    MODULE(121U) \
+    MODULE(124U) \
+    MODULE(250U) \
+    MODULE(251U)
+
+/* Time stamp of the reported errors, read once Det_Init is called (after Gpt_StartTimeBase) */
+#define DET_TIMESTAMP()                       Gpt_GetTimeStamp()
+
+/*
+ * Error hooks called with each recorded error, in the context of the caller (a task or an interrupt), so they
+ * shall be short and shall not report development errors themselves: DET_ERROR_HOOKS_LIST(HOOK) HOOK(Name) ...
+ * Each hook is a void Name(const Det_ErrorType * ErrorPtr) function. Empty for no hooks.
+ */
+#define DET_ERROR_HOOKS_LIST(HOOK)
+
+/*
+ * Pre-compile option to stop in Det_ReportError after the error is recorded and the hooks are called,
+ * the behavior of the previous Det for the debugging sessions. STD_OFF for the field.
+ */
+#define DET_HALT_ON_ERROR                     (STD_OFF)
+
+#endif /* DET_CFG_H */
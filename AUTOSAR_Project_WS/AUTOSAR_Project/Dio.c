@@ -12,6 +12,45 @@
 #include "Dio.h"
 #include "Dio_Regs.h"
 
+#if (DIO_PRE_COMPILE_CHANNELS_API == STD_ON)
+/* The services below are the runtime checked ones, not the routing macros of Dio.h for constant channel IDs */
+#undef Dio_WriteChannel
+#undef Dio_ReadChannel
+#undef Dio_FlipChannel
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+#include "Irq.h"
+#include "Gpt.h"
+
+/* The queue indexes are wrapped with a mask */
+#if ((DIO_EDGE_QUEUE_SIZE & (DIO_EDGE_QUEUE_SIZE - 1U)) != 0U) || (DIO_EDGE_QUEUE_SIZE > 128U)
+  #error "DIO_EDGE_QUEUE_SIZE shall be a power of 2 up to 128"
+#endif
+#endif
+
+#if (DIO_WRITE_SEQUENCE_API == STD_ON)
+#include "Gpt.h"
+
+/*
+ * Ports kept clocked in both Sleep and Deep-Sleep modes (bit0 --> PORTA ... bit5 --> PORTF). The uDMA keeps writing
+ * a sequence during the Os idle sleep, so it is only accepted on a group of one of these ports.
+ */
+#define DIO_SEQUENCE_CLOCKED_PORTS        (MCU_SLEEP_GPIO_CLOCK_GATING & MCU_DEEP_SLEEP_GPIO_CLOCK_GATING)
+
+/* The sequence groups are a configuration property, a group on a gated port fails the build */
+#define DIO_CHECK_SEQUENCE_GROUP(NAME) \
+	STATIC_ASSERT(0U != (DIO_SEQUENCE_CLOCKED_PORTS & (1U << DioConf_##NAME##_PORT_NUM)), Dio_##NAME##_SequencePortGated);
+
+DIO_SEQUENCE_GROUPS_LIST(DIO_CHECK_SEQUENCE_GROUP)
+#endif
+
+/* Input to output latency instrumentation hooks (Non AUTOSAR), empty macros when the instrumentation is off */
+#include "Latency.h"
+#if (LATENCY_INSTRUMENTATION == STD_ON)
+#include "Gpt.h"
+#endif
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 
 #include "Det.h"
@@ -24,8 +63,207 @@
 
 #endif
 
+/* Number of the TM4C123GH6PM GPIO Ports (PORTA ... PORTF) */
+#define DIO_NUMBER_OF_PORTS            (6U)
+
+/* Pre-computed access of one channel: data address masked to the channel pin and the pin value */
+typedef struct
+{
+	volatile uint32 * Data;
+	uint8 Bit;
+	uint8 Pin;
+	Dio_PortType Port;
+} Dio_ChannelAccessType;
+
+/* GPIO Ports base addresses indexed by the Port Id */
+STATIC const uint32 Dio_PortBaseAddress[DIO_NUMBER_OF_PORTS] = {
+                                                                   GPIO_PORTA_BASE_ADDRESS,GPIO_PORTB_BASE_ADDRESS,
+                                                                   GPIO_PORTC_BASE_ADDRESS,GPIO_PORTD_BASE_ADDRESS,
+                                                                   GPIO_PORTE_BASE_ADDRESS,GPIO_PORTF_BASE_ADDRESS
+                                                               };
+
+/* Data register of a port accessed through the address masked to the selected pins */
+#define DIO_PORT_DATA(PORT_ID,MASK) \
+	(*(volatile uint32 *)(Dio_PortBaseAddress[(PORT_ID)] + DIO_DATA_MASKED_OFFSET(MASK)))
+
+/* Any GPIO register of a port */
+#define DIO_PORT_REG(PORT_ID,OFFSET) \
+	(*(volatile uint32 *)(Dio_PortBaseAddress[(PORT_ID)] + (OFFSET)))
+
+/* Mask selecting all the 8 pins of a port */
+#define DIO_PORT_ALL_PINS_MASK         (0xFFU)
+
 STATIC const Dio_ConfigChannel * Dio_PortChannels = NULL_PTR;
-STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
+STATIC Dio_ChannelAccessType Dio_ChannelAccess[DIO_CONFIGURED_CHANNLES];
+#if (DIO_WRITE_BATCH_API == STD_ON)
+STATIC const Dio_OutputSetType * Dio_OutputSets = NULL_PTR;
+/* Pins of each port driven by each output set, coalesced at Dio_Init */
+STATIC uint8 Dio_OutputSetMask[DIO_CONFIGURED_OUTPUT_SETS][DIO_NUMBER_OF_PORTS];
+#endif
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/* Number of the pins of one port */
+#define DIO_PINS_PER_PORT              (8U)
+
+/* Value of Dio_PinChannel for the pins without edge notification */
+#define DIO_NO_CHANNEL                 (0xFFU)
+
+/* Channel of each pin with edge notification, used by the port interrupt */
+STATIC uint8 Dio_PinChannel[DIO_NUMBER_OF_PORTS][DIO_PINS_PER_PORT];
+
+/* Edge events left to each channel until the next Dio_EdgeMainFunction */
+STATIC volatile uint8 Dio_EdgeBudget[DIO_CONFIGURED_CHANNLES];
+
+/* Edge events queue: the head is written by the port interrupts only and the tail by the task only */
+STATIC Dio_EdgeEventType Dio_EdgeQueue[DIO_EDGE_QUEUE_SIZE];
+STATIC volatile uint8 Dio_EdgeQueueHead = 0;
+STATIC volatile uint8 Dio_EdgeQueueTail = 0;
+
+/* Number of the edge events lost because the queue was full */
+STATIC volatile uint32 Dio_EdgeOverflowCount = 0;
+
+/* Function to handle the edge interrupt of one port */
+STATIC void Dio_EdgeHandler(Dio_PortType PortId)
+{
+	/* Read the pending edges once (raw status of the enabled pins) and clear them with a single write */
+	uint8 pending = (uint8)DIO_PORT_REG(PortId,DIO_GPIO_MIS_REG_OFFSET);
+	uint32 timestamp = Gpt_GetTimeStamp();
+	uint8 levels;
+	uint8 pin;
+
+	DIO_PORT_REG(PortId,DIO_GPIO_ICR_REG_OFFSET) = pending;
+	levels = (uint8)DIO_PORT_DATA(PortId,pending);
+
+	for(pin = 0; (pin < DIO_PINS_PER_PORT) && (pending != 0); pin++)
+	{
+		if(pending & (1U << pin))
+		{
+			uint8 channel = Dio_PinChannel[PortId][pin];
+			uint8 next = (uint8)((Dio_EdgeQueueHead + 1U) & (DIO_EDGE_QUEUE_SIZE - 1U));
+			Dio_LevelType level = (levels & (1U << pin)) ? STD_HIGH : STD_LOW;
+
+			pending &= (uint8)(~(1U << pin));
+
+			if(next != Dio_EdgeQueueTail)
+			{
+				Dio_EdgeQueue[Dio_EdgeQueueHead].ChannelId = channel;
+				Dio_EdgeQueue[Dio_EdgeQueueHead].Level     = level;
+				Dio_EdgeQueue[Dio_EdgeQueueHead].TimeStamp = timestamp;
+				Dio_EdgeQueueHead = next;
+			}
+			else
+			{
+				Dio_EdgeOverflowCount++;
+			}
+
+			LATENCY_INPUT_EDGE(channel,level,timestamp);
+
+			/* The upper layer acts on the edge in the interrupt itself, without waiting for a task */
+			if(NULL_PTR != Dio_PortChannels[channel].Notification)
+			{
+				Dio_PortChannels[channel].Notification(channel,level,timestamp);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+
+			/* Rate limit: a bouncing or noisy pin is masked until the next Dio_EdgeMainFunction */
+			Dio_EdgeBudget[channel]--;
+			if(0U == Dio_EdgeBudget[channel])
+			{
+				BITBAND_CLEAR_BIT(DIO_PORT_REG(PortId,DIO_GPIO_IM_REG_OFFSET),pin);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+		else
+		{
+			/* No Action Required */
+		}
+	}
+}
+
+/* Port interrupts installed in the RAM vector table for the ports with edge notifications */
+STATIC void Dio_GpioPortA_Handler(void) { Dio_EdgeHandler(0); }
+STATIC void Dio_GpioPortB_Handler(void) { Dio_EdgeHandler(1); }
+STATIC void Dio_GpioPortC_Handler(void) { Dio_EdgeHandler(2); }
+STATIC void Dio_GpioPortD_Handler(void) { Dio_EdgeHandler(3); }
+STATIC void Dio_GpioPortE_Handler(void) { Dio_EdgeHandler(4); }
+STATIC void Dio_GpioPortF_Handler(void) { Dio_EdgeHandler(5); }
+
+STATIC const Irq_VectorType Dio_PortVector[DIO_NUMBER_OF_PORTS] = {
+                                                                      IRQ_GPIO_PORTA_VECTOR,IRQ_GPIO_PORTB_VECTOR,
+                                                                      IRQ_GPIO_PORTC_VECTOR,IRQ_GPIO_PORTD_VECTOR,
+                                                                      IRQ_GPIO_PORTE_VECTOR,IRQ_GPIO_PORTF_VECTOR
+                                                                  };
+
+STATIC const Irq_HandlerType Dio_PortHandler[DIO_NUMBER_OF_PORTS] = {
+                                                                        Dio_GpioPortA_Handler,Dio_GpioPortB_Handler,
+                                                                        Dio_GpioPortC_Handler,Dio_GpioPortD_Handler,
+                                                                        Dio_GpioPortE_Handler,Dio_GpioPortF_Handler
+                                                                    };
+#endif
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+/* Configured pins of each port, the process image of each port and its outputs changed since the last flush */
+STATIC uint8 Dio_ImageMask[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_Image[DIO_NUMBER_OF_PORTS];
+STATIC uint8 Dio_ImageDirty[DIO_NUMBER_OF_PORTS];
+#endif
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/* Output pins of the configured channels in each port (GPIODIR at Dio_Init), also read by the accessors of Dio.h */
+uint8 Dio_ShadowMask[DIO_NUMBER_OF_PORTS];
+
+/* Last level written to the pins of each port ... one word per port in SRAM so one pin is updated with a bit-band store */
+volatile uint32 Dio_OutputShadow[DIO_NUMBER_OF_PORTS];
+
+/* Single store update of the shadow of one channel */
+#define DIO_SHADOW_WRITE_CHANNEL(CHANNEL_ID,LEVEL) \
+	BITBAND_WRITE_BIT(Dio_OutputShadow[Dio_ChannelAccess[(CHANNEL_ID)].Port],Dio_ChannelAccess[(CHANNEL_ID)].Pin,(LEVEL))
+
+/* Update of the shadow of the pins selected by MASK after a port, group or batch write */
+#define DIO_SHADOW_WRITE_MASKED(PORT_ID,MASK,VALUE) \
+	Dio_ShadowWriteMasked((PORT_ID),(uint32)(MASK),(uint32)(VALUE))
+
+/* Check if a channel is an output served by the shadow */
+#define DIO_CHANNEL_IS_OUTPUT(CHANNEL_ID) \
+	(0U != (Dio_ShadowMask[Dio_ChannelAccess[(CHANNEL_ID)].Port] & Dio_ChannelAccess[(CHANNEL_ID)].Bit))
+
+/* Level of an output channel from the shadow */
+#define DIO_SHADOW_READ_CHANNEL(CHANNEL_ID) \
+	((Dio_OutputShadow[Dio_ChannelAccess[(CHANNEL_ID)].Port] & Dio_ChannelAccess[(CHANNEL_ID)].Bit) ? STD_HIGH : STD_LOW)
+
+/*
+ * Disable the interrupts between a load of the shadow and its store to the pins, so a pin written by an ISR in
+ * between is not driven back to its previous level, the PRIMASK value is saved and restored
+ */
+#define Dio_EnterCritical(STATE)   ((STATE) = _disable_IRQ())
+#define Dio_ExitCritical(STATE)    _restore_interrupts(STATE)
+#endif
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/*
+ * Function to update the shadow of the pins selected by Mask without losing the shadow writes of the ISRs
+ * (Led_ToggleNow bit-band store, Led software PWM group writes) to the other pins of the port.
+ * The read-modify-write uses LDREX/STREX: the exception entry and return clear the exclusive monitor,
+ * so the store fails and the update is done again if an interrupt ran since the exclusive load.
+ */
+RAM_FUNC STATIC void Dio_ShadowWriteMasked(Dio_PortType PortId, uint32 Mask, uint32 Value)
+{
+	uint32 shadow;
+
+	do
+	{
+		shadow = ((uint32)__ldrex((void *)&Dio_OutputShadow[PortId]) & ~Mask) | (Value & Mask);
+	} while(0 != __strex(shadow,(void *)&Dio_OutputShadow[PortId]));
+}
+#endif
+#if (DIO_WRITE_SEQUENCE_API == STD_ON)
+/* Channel group written by the last sequence, its shadow is updated when the sequence is done */
+STATIC const Dio_ChannelGroupType * Dio_SequenceGroup = NULL_PTR;
+#endif
+/* Driver state, also read by the compile-time channel services of Dio.h for the DIO_E_UNINIT check */
+uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
 /************************************************************************************
 * Service Name: Dio_Init
@@ -40,6 +278,8 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 ************************************************************************************/
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+	uint8 index;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
 	/* check if the input configuration pointer is not a NULL_PTR */
 	if (NULL_PTR == ConfigPtr)
@@ -54,8 +294,122 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 		 * Set the module state to initialized and point to the PB configuration structure using a global pointer.
 		 * This global pointer is global to be used by other functions to read the PB configuration structures
 		 */
-		Dio_Status       = DIO_INITIALIZED;
 		Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+		/*
+		 * Pre-compute the data address masked to the pin of each channel, so the channel APIs
+		 * access the pin with a single load/store without a read-modify-write of the whole port.
+		 */
+		for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			Dio_ChannelAccess[index].Port = Dio_PortChannels[index].Port_Num;
+			Dio_ChannelAccess[index].Pin  = Dio_PortChannels[index].Ch_Num;
+			Dio_ChannelAccess[index].Bit  = (uint8)(1U << Dio_PortChannels[index].Ch_Num);
+			Dio_ChannelAccess[index].Data = (volatile uint32 *)(Dio_PortBaseAddress[Dio_PortChannels[index].Port_Num]
+			                              + DIO_DATA_MASKED_OFFSET(Dio_ChannelAccess[index].Bit));
+		}
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		/* The configured channels set as outputs by Port_Init are served by the shadow, starting with their current levels */
+		for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+		{
+			Dio_ShadowMask[index] = 0;
+		}
+		for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			Dio_ShadowMask[Dio_ChannelAccess[index].Port] |= Dio_ChannelAccess[index].Bit;
+		}
+		for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+		{
+			if(Dio_ShadowMask[index] != 0)
+			{
+				Dio_ShadowMask[index]   &= (uint8)DIO_PORT_REG(index,DIO_GPIO_DIR_REG_OFFSET);
+				Dio_OutputShadow[index]  = DIO_PORT_DATA(index,Dio_ShadowMask[index]);
+			}
+			else
+			{
+				Dio_OutputShadow[index]  = 0;
+			}
+		}
+#endif
+
+#if (DIO_WRITE_BATCH_API == STD_ON)
+		/* Coalesce the pins of each output set per port, so a set is written with one store per port */
+		Dio_OutputSets = ConfigPtr->OutputSets;
+		for(index = 0; index < DIO_CONFIGURED_OUTPUT_SETS; index++)
+		{
+			uint8 port;
+			uint8 channel;
+
+			for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+			{
+				Dio_OutputSetMask[index][port] = 0;
+			}
+			for(channel = 0; channel < Dio_OutputSets[index].NumberOfChannels; channel++)
+			{
+				Dio_ChannelType ChannelId = Dio_OutputSets[index].Channels[channel];
+				Dio_OutputSetMask[index][Dio_ChannelAccess[ChannelId].Port] |= Dio_ChannelAccess[ChannelId].Bit;
+			}
+		}
+#endif
+
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+		/* Collect the configured pins of each port and start with an image of their current levels */
+		for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+		{
+			Dio_ImageMask[index]  = 0;
+			Dio_ImageDirty[index] = 0;
+		}
+		for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			Dio_ImageMask[Dio_ChannelAccess[index].Port] |= Dio_ChannelAccess[index].Bit;
+		}
+		for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+		{
+			Dio_Image[index] = (Dio_ImageMask[index] != 0) ? (uint8)DIO_PORT_DATA(index,Dio_ImageMask[index]) : 0;
+		}
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+		/* Configure the edge detection of the channels with edge notification then install the port interrupts */
+		for(index = 0; index < DIO_NUMBER_OF_PORTS; index++)
+		{
+			uint8 pin;
+
+			for(pin = 0; pin < DIO_PINS_PER_PORT; pin++)
+			{
+				Dio_PinChannel[index][pin] = DIO_NO_CHANNEL;
+			}
+		}
+		for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			Dio_PortType port = Dio_PortChannels[index].Port_Num;
+			Dio_ChannelType pin = Dio_PortChannels[index].Ch_Num;
+
+			if(DIO_EDGE_NONE != Dio_PortChannels[index].Edge)
+			{
+				Dio_PinChannel[port][pin] = index;
+				Dio_EdgeBudget[index]     = DIO_EDGE_MAX_EVENTS_PER_TICK;
+
+				/* Edge sensitive, both edges or only the rising/falling edge */
+				BITBAND_CLEAR_BIT(DIO_PORT_REG(port,DIO_GPIO_IS_REG_OFFSET),pin);
+				BITBAND_WRITE_BIT(DIO_PORT_REG(port,DIO_GPIO_IBE_REG_OFFSET),pin,
+				                  (DIO_EDGE_BOTH == Dio_PortChannels[index].Edge));
+				BITBAND_WRITE_BIT(DIO_PORT_REG(port,DIO_GPIO_IEV_REG_OFFSET),pin,
+				                  (DIO_EDGE_RISING == Dio_PortChannels[index].Edge));
+
+				/* Clear any edge detected during the configuration then enable the pin interrupt */
+				DIO_PORT_REG(port,DIO_GPIO_ICR_REG_OFFSET) = (1U << pin);
+				Irq_Register(Dio_PortVector[port],Dio_PortHandler[port]);
+				BITBAND_SET_BIT(DIO_PORT_REG(port,DIO_GPIO_IM_REG_OFFSET),pin);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+#endif
+		Dio_Status       = DIO_INITIALIZED;
 	}
 }
 
@@ -71,9 +425,8 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 * Return value: None
 * Description: Function to set a level of a channel.
 ************************************************************************************/
-void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+RAM_FUNC void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -105,31 +458,22 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
+		/* The masked address selects only the channel pin ... a single store, the other pins are not affected */
 		if(Level == STD_HIGH)
 		{
 			/* Write Logic High */
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Dio_ChannelAccess[ChannelId].Data = Dio_ChannelAccess[ChannelId].Bit;
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+			DIO_SHADOW_WRITE_CHANNEL(ChannelId,STD_HIGH);
+#endif
 		}
 		else if(Level == STD_LOW)
 		{
 			/* Write Logic Low */
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+			*Dio_ChannelAccess[ChannelId].Data = 0;
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+			DIO_SHADOW_WRITE_CHANNEL(ChannelId,STD_LOW);
+#endif
 		}
 	}
 	else
@@ -150,9 +494,8 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 * Return value: Dio_LevelType
 * Description: Function to return the value of the specified DIO channel.
 ************************************************************************************/
-Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+RAM_FUNC Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
 	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
@@ -185,24 +528,16 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		if(DIO_CHANNEL_IS_OUTPUT(ChannelId))
+		{
+			/* The level of an output is the last written level ... no bus access */
+			output = DIO_SHADOW_READ_CHANNEL(ChannelId);
+		}
+		else
+#endif
+		/* Read the required channel ... the masked address returns 0 for all the other pins */
+		if(*Dio_ChannelAccess[ChannelId].Data != 0)
 		{
 			output = STD_HIGH;
 		}
@@ -219,60 +554,73 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 }
 
 /************************************************************************************
-* Service Name: Dio_GetVersionInfo
-* Service ID[hex]: 0x12
+* Service Name: Dio_ReadPort
+* Service ID[hex]: 0x02
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): None
+* Parameters (in): PortId - ID of DIO Port.
 * Parameters (inout): None
-* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
-* Return value: None
-* Description: Function to get the version information of this module.
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the level of all channels of that port.
 ************************************************************************************/
-#if (DIO_VERSION_INFO_API == STD_ON)
-void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
 {
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
-	/* Check if input pointer is not Null pointer */
-	if(NULL_PTR == versioninfo)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
-		/* Report to DET  */
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+				DIO_READ_PORT_SID, DIO_E_UNINIT);
+		error = TRUE;
 	}
 	else
-#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
 	{
-		/* Copy the vendor Id */
-		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
-		/* Copy the module Id */
-		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
-		/* Copy Software Major Version */
-		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
-		/* Copy Software Minor Version */
-		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
-		/* Copy Software Patch Version */
-		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
 	}
-}
 #endif
 
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Read all the pins of the port through the fully unmasked data address */
+		output = (Dio_PortLevelType)DIO_PORT_DATA(PortId,DIO_PORT_ALL_PINS_MASK);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
 /************************************************************************************
-* Service Name: Dio_FlipChannel
-* Service ID[hex]: 0x11
+* Service Name: Dio_WritePort
+* Service ID[hex]: 0x03
 * Sync/Async: Synchronous
 * Reentrancy: Reentrant
-* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (in): PortId - ID of DIO Port.
+*                  Level - Value to be written.
 * Parameters (inout): None
 * Parameters (out): None
-* Return value: Dio_LevelType
-* Description: Function to flip the level of a channel and return the level of the channel after flip.
+* Return value: None
+* Description: Function to set a value of the port, the input pins are not affected.
 ************************************************************************************/
-#if (DIO_FLIP_CHANNEL_API == STD_ON)
-Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
 {
-	volatile uint32 * Port_Ptr = NULL_PTR;
-	Dio_LevelType output = STD_LOW;
 	boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -280,19 +628,82 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	if (DIO_NOT_INITIALIZED == Dio_Status)
 	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+				DIO_WRITE_PORT_SID, DIO_E_UNINIT);
 		error = TRUE;
 	}
 	else
 	{
 		/* No Action Required */
 	}
-	/* Check if the used channel is within the valid range */
-	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Write all the pins of the port with a single store, the writes to the input pins are ignored */
+		DIO_PORT_DATA(PortId,DIO_PORT_ALL_PINS_MASK) = Level;
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		DIO_SHADOW_WRITE_MASKED(PortId,DIO_PORT_ALL_PINS_MASK,Level);
+#endif
+	}
+	else
 	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelGroup
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to read a subset of the adjoining bits of a port, the value
+*              is shifted right by the group offset.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
 
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
 		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
-				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the channel group pointer is not a NULL_PTR */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the channel group belongs to a valid port */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
 		error = TRUE;
 	}
 	else
@@ -304,33 +715,1020 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 	/* In-case there are no errors */
 	if(FALSE == error)
 	{
-		/* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-		switch(Dio_PortChannels[ChannelId].Port_Num)
-		{
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-		               break;
-		    case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-		               break;
-		    case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-		               break;
-		    case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-		               break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-		               break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-		               break;
-		}
-		/* Read the required channel and write the required level */
-		if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
-		{
-			CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_LOW;
-		}
-		else
-		{
-			SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
-			output = STD_HIGH;
-		}
+		/* The masked data address returns 0 for the pins out of the group ... a single load */
+		output = (Dio_PortLevelType)(DIO_PORT_DATA(ChannelGroupIdPtr->PortIndex,ChannelGroupIdPtr->mask)
+		                             >> ChannelGroupIdPtr->offset);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelGroup
+* Service ID[hex]: 0x05
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set a subset of the adjoining bits of a port to a specified
+*              level, the value is shifted left by the group offset. The other pins of
+*              the port are not changed.
+************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the channel group pointer is not a NULL_PTR */
+	if (NULL_PTR == ChannelGroupIdPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	/* Check if the channel group belongs to a valid port */
+	else if (DIO_NUMBER_OF_PORTS <= ChannelGroupIdPtr->PortIndex)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* The masked data address changes only the group pins ... a single atomic store for the whole group */
+		DIO_PORT_DATA(ChannelGroupIdPtr->PortIndex,ChannelGroupIdPtr->mask) =
+				(uint32)(Level << ChannelGroupIdPtr->offset);
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		DIO_SHADOW_WRITE_MASKED(ChannelGroupIdPtr->PortIndex,ChannelGroupIdPtr->mask,
+		                        (uint32)(Level << ChannelGroupIdPtr->offset));
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+#if (DIO_WRITE_BATCH_API == STD_ON)
+/* Function to write the coalesced value of each port with one store masked to the pins to be changed */
+STATIC void Dio_WritePortsMasked(const uint8 * Mask, const uint8 * Value)
+{
+	uint8 port;
+
+	for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+	{
+		if(Mask[port] != 0)
+		{
+			/* All the selected pins of this port change in the same bus cycle */
+			DIO_PORT_DATA(port,Mask[port]) = Value[port];
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+			DIO_SHADOW_WRITE_MASKED(port,Mask[port],Value[port]);
+#endif
+		}
+		else
+		{
+			/* No Action Required ... this port is not affected */
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelBatch
+* Service ID[hex]: 0x13
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelIdPtr - Pointer to the IDs of the DIO channels.
+*                  LevelPtr - Pointer to the values to be written (one per channel).
+*                  NumberOfChannels - Number of the channels to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the levels of several channels. The parameters are checked
+*              once for the whole batch and the levels are coalesced in one masked store
+*              per affected port.
+************************************************************************************/
+void Dio_WriteChannelBatch(const Dio_ChannelType * ChannelIdPtr, const Dio_LevelType * LevelPtr,
+                           uint8 NumberOfChannels)
+{
+	uint8 mask[DIO_NUMBER_OF_PORTS]  = {0};
+	uint8 value[DIO_NUMBER_OF_PORTS] = {0};
+	uint8 index;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_BATCH_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the input pointers are not NULL_PTR */
+	if ((NULL_PTR == ChannelIdPtr) || (NULL_PTR == LevelPtr))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_BATCH_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* Check if all the used channels are within the valid range */
+		for(index = 0; index < NumberOfChannels; index++)
+		{
+			if (DIO_CONFIGURED_CHANNLES <= ChannelIdPtr[index])
+			{
+				Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+						DIO_WRITE_CHANNEL_BATCH_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+				error = TRUE;
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		/* Coalesce the pins and the levels of the batch per port */
+		for(index = 0; index < NumberOfChannels; index++)
+		{
+			const Dio_ChannelAccessType * Channel = &Dio_ChannelAccess[ChannelIdPtr[index]];
+
+			mask[Channel->Port] |= Channel->Bit;
+			if(STD_HIGH == LevelPtr[index])
+			{
+				value[Channel->Port] |= Channel->Bit;
+			}
+			else
+			{
+				value[Channel->Port] &= (uint8)(~Channel->Bit);
+			}
+		}
+		Dio_WritePortsMasked(mask,value);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteOutputSet
+* Service ID[hex]: 0x14
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): OutputSetId - Index of the configured output set.
+*                  LevelPtr - Pointer to the values to be written (one per channel of the set).
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the levels of the channels of a configured output set.
+*              The channels and the per port masks are checked and coalesced at Dio_Init.
+************************************************************************************/
+void Dio_WriteOutputSet(uint8 OutputSetId, const Dio_LevelType * LevelPtr)
+{
+	uint8 value[DIO_NUMBER_OF_PORTS] = {0};
+	uint8 index;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_OUTPUT_SET_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used output set is within the valid range */
+	if (DIO_CONFIGURED_OUTPUT_SETS <= OutputSetId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_OUTPUT_SET_SID, DIO_E_PARAM_INVALID_OUTPUT_SET);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the input pointer is not a NULL_PTR */
+	if (NULL_PTR == LevelPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_OUTPUT_SET_SID, DIO_E_PARAM_POINTER);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		for(index = 0; index < Dio_OutputSets[OutputSetId].NumberOfChannels; index++)
+		{
+			const Dio_ChannelAccessType * Channel = &Dio_ChannelAccess[Dio_OutputSets[OutputSetId].Channels[index]];
+
+			if(STD_HIGH == LevelPtr[index])
+			{
+				value[Channel->Port] |= Channel->Bit;
+			}
+			else
+			{
+				/* No Action Required ... the masked store writes 0 to this pin */
+			}
+		}
+		Dio_WritePortsMasked(Dio_OutputSetMask[OutputSetId],value);
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+#endif
+
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_LatchImage
+* Service ID[hex]: 0x15
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to latch the levels of all the configured pins in the process
+*              image with one masked load per port. Called at the start of each Os tick
+*              so all the tasks see the same input levels during the tick.
+************************************************************************************/
+void Dio_LatchImage(void)
+{
+	uint8 port;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_LATCH_IMAGE_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+		{
+			if(Dio_ImageMask[port] != 0)
+			{
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+				/* Only the inputs are loaded from the port, the outputs are taken from the shadow */
+				uint8 latched = (uint8)((DIO_PORT_DATA(port,Dio_ImageMask[port] & (uint8)(~Dio_ShadowMask[port]))
+				                       | Dio_OutputShadow[port]) & Dio_ImageMask[port]);
+#else
+				uint8 latched = (uint8)DIO_PORT_DATA(port,Dio_ImageMask[port]);
+#endif
+				/* Keep the outputs written and not yet flushed */
+				Dio_Image[port] = (uint8)((Dio_Image[port] & Dio_ImageDirty[port])
+				                | (latched & (uint8)(~Dio_ImageDirty[port])));
+			}
+			else
+			{
+				/* No Action Required ... no configured pins in this port */
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_FlushImage
+* Service ID[hex]: 0x16
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the outputs changed in the process image with one
+*              masked store per port. Called at the end of each Os tick.
+************************************************************************************/
+void Dio_FlushImage(void)
+{
+	uint8 port;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLUSH_IMAGE_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+		{
+			if(Dio_ImageDirty[port] != 0)
+			{
+				/* Only the changed pins are selected by the masked address */
+				DIO_PORT_DATA(port,Dio_ImageDirty[port]) = Dio_Image[port];
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+				DIO_SHADOW_WRITE_MASKED(port,Dio_ImageDirty[port],Dio_Image[port]);
+#endif
+				LATENCY_OUTPUT_WRITE(port,Dio_ImageDirty[port],Gpt_GetTimeStamp());
+				Dio_ImageDirty[port] = 0;
+			}
+			else
+			{
+				/* No Action Required ... no changed outputs in this port */
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadChannelImage
+* Service ID[hex]: 0x17
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to return the level of a channel from the process image, the
+*              level latched at the start of the tick or the level written in this tick.
+************************************************************************************/
+Dio_LevelType Dio_ReadChannelImage(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_IMAGE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_CHANNEL_IMAGE_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		if(Dio_Image[Dio_ChannelAccess[ChannelId].Port] & Dio_ChannelAccess[ChannelId].Bit)
+		{
+			output = STD_HIGH;
+		}
+		else
+		{
+			output = STD_LOW;
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_WriteChannelImage
+* Service ID[hex]: 0x18
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+*                  Level - Value to be written.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the level of a channel in the process image, the pin is
+*              written by the next Dio_FlushImage.
+************************************************************************************/
+void Dio_WriteChannelImage(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_IMAGE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_CHANNEL_IMAGE_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		if(Level == STD_HIGH)
+		{
+			Dio_Image[Dio_ChannelAccess[ChannelId].Port] |= Dio_ChannelAccess[ChannelId].Bit;
+		}
+		else
+		{
+			Dio_Image[Dio_ChannelAccess[ChannelId].Port] &= (uint8)(~Dio_ChannelAccess[ChannelId].Bit);
+		}
+		Dio_ImageDirty[Dio_ChannelAccess[ChannelId].Port] |= Dio_ChannelAccess[ChannelId].Bit;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_FlipChannelImage
+* Service ID[hex]: 0x19
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to flip the level of a channel in the process image and return
+*              the level after flip, the pin is written by the next Dio_FlushImage.
+************************************************************************************/
+Dio_LevelType Dio_FlipChannelImage(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = (STD_HIGH == Dio_ReadChannelImage(ChannelId)) ? STD_LOW : STD_HIGH;
+
+	Dio_WriteChannelImage(ChannelId,output);
+	return output;
+}
+
+/************************************************************************************
+* Service Name: Dio_ReadPortImage
+* Service ID[hex]: 0x1F
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): PortId - ID of DIO Port.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_PortLevelType
+* Description: Function to return the levels of the configured channels of a port from
+*              the process image, the pins which are not configured channels read 0.
+************************************************************************************/
+Dio_PortLevelType Dio_ReadPortImage(Dio_PortType PortId)
+{
+	Dio_PortLevelType output = 0;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_IMAGE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used port is within the valid range */
+	if (DIO_NUMBER_OF_PORTS <= PortId)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_READ_PORT_IMAGE_SID, DIO_E_PARAM_INVALID_PORT_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		output = (Dio_PortLevelType)Dio_Image[PortId];
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return output;
+}
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_GetEdgeEvent
+* Service ID[hex]: 0x1A
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): EventPtr - Pointer to where to store the oldest edge event.
+* Return value: boolean - TRUE if an event is returned, FALSE if the queue is empty
+* Description: Function to get the oldest edge event queued by the port interrupts.
+*              Shall be called from one task only (single consumer).
+************************************************************************************/
+boolean Dio_GetEdgeEvent(Dio_EdgeEventType * EventPtr)
+{
+	boolean available = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_EDGE_EVENT_SID, DIO_E_UNINIT);
+	}
+	/* Check if the output pointer is not a NULL_PTR */
+	else if (NULL_PTR == EventPtr)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_EDGE_EVENT_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif
+	{
+		if(Dio_EdgeQueueTail != Dio_EdgeQueueHead)
+		{
+			/* The event is copied before the tail is moved, so the interrupt can not overwrite it */
+			*EventPtr = Dio_EdgeQueue[Dio_EdgeQueueTail];
+			Dio_EdgeQueueTail = (uint8)((Dio_EdgeQueueTail + 1U) & (DIO_EDGE_QUEUE_SIZE - 1U));
+			available = TRUE;
+		}
+		else
+		{
+			/* No Action Required ... the queue is empty */
+		}
+	}
+	return available;
+}
+
+/************************************************************************************
+* Service Name: Dio_EdgeMainFunction
+* Service ID[hex]: 0x1B
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to refill the edge budget of each channel and to enable again
+*              the interrupts of the rate limited channels. Called every Os tick.
+************************************************************************************/
+void Dio_EdgeMainFunction(void)
+{
+	uint8 index;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_EDGE_MAIN_FUNCTION_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(index = 0; index < DIO_CONFIGURED_CHANNLES; index++)
+		{
+			if(DIO_EDGE_NONE != Dio_PortChannels[index].Edge)
+			{
+				Dio_PortType port = Dio_PortChannels[index].Port_Num;
+				Dio_ChannelType pin = Dio_PortChannels[index].Ch_Num;
+
+				/*
+				 * The decision is taken on the interrupt mask bit and not on the budget: if the interrupt masks
+				 * the pin after this check, the pin is found masked and enabled again at the next call.
+				 */
+				if(0U == BITBAND_GET_BIT(DIO_PORT_REG(port,DIO_GPIO_IM_REG_OFFSET),pin))
+				{
+					/* The edges of the masked period are dropped, the channel level is read again by the task */
+					Dio_EdgeBudget[index] = DIO_EDGE_MAX_EVENTS_PER_TICK;
+					DIO_PORT_REG(port,DIO_GPIO_ICR_REG_OFFSET) = (1U << pin);
+					BITBAND_SET_BIT(DIO_PORT_REG(port,DIO_GPIO_IM_REG_OFFSET),pin);
+				}
+				else
+				{
+					Dio_EdgeBudget[index] = DIO_EDGE_MAX_EVENTS_PER_TICK;
+				}
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+}
+#endif
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_RefreshOutputs
+* Service ID[hex]: 0x1D
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to write the shadow of the output pins with one masked store
+*              per port, an output changed by another master is driven again to the
+*              last written level without any read of the port. Each store is done
+*              with the interrupts disabled, so the pin writes of the ISRs are kept.
+************************************************************************************/
+void Dio_RefreshOutputs(void)
+{
+	uint8 port;
+	uint32 primask;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_REFRESH_OUTPUTS_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+		{
+			if(Dio_ShadowMask[port] != 0)
+			{
+				Dio_EnterCritical(primask);
+				DIO_PORT_DATA(port,Dio_ShadowMask[port]) = Dio_OutputShadow[port];
+				Dio_ExitCritical(primask);
+			}
+			else
+			{
+				/* No Action Required ... no configured outputs in this port */
+			}
+		}
+	}
+}
+
+/************************************************************************************
+* Service Name: Dio_VerifyOutputs
+* Service ID[hex]: 0x1E
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint8 - Mask of the ports (bit0 --> PORTA ... bit5 --> PORTF) with at
+*                       least one output pin different from its shadow, 0 if all match
+* Description: Function to compare the output pins with their shadow with one masked
+*              load per port, to detect the stuck or overwritten outputs.
+************************************************************************************/
+uint8 Dio_VerifyOutputs(void)
+{
+	uint8 mismatch = 0;
+	uint8 port;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_VERIFY_OUTPUTS_SID, DIO_E_UNINIT);
+	}
+	else
+#endif
+	{
+		for(port = 0; port < DIO_NUMBER_OF_PORTS; port++)
+		{
+			if((Dio_ShadowMask[port] != 0) &&
+			   (DIO_PORT_DATA(port,Dio_ShadowMask[port]) != (Dio_OutputShadow[port] & Dio_ShadowMask[port])))
+			{
+				mismatch |= (uint8)(1U << port);
+			}
+			else
+			{
+				/* No Action Required */
+			}
+		}
+	}
+	return mismatch;
+}
+#endif
+
+#if (DIO_WRITE_SEQUENCE_API == STD_ON)
+/************************************************************************************
+* Service Name: Dio_WriteSequence
+* Service ID[hex]: 0x1C
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+*                  SamplesPtr - Port levels to be written, only the pins of the group are driven.
+*                               The buffer shall stay valid until Dio_IsSequenceDone returns TRUE.
+*                  NumberOfSamples - Number of the samples (1 --> DMA_MAX_TRANSFER_SIZE).
+*                  SamplePeriod - Time between two samples in system clock counts.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Std_ReturnType - E_OK if the sequence is started,
+*                                E_NOT_OK if the previous sequence is not finished.
+* Description: Function to write a sequence of levels to the pins of a channel group.
+*              Each time-out of the pacing timer requests the uDMA to copy the next sample
+*              to the data address masked to the group pins, so the samples are written at
+*              a fixed rate without any CPU involvement. Unlike Dio_WriteChannelGroup the
+*              samples are not shifted by the group offset (the uDMA copies them as is).
+*              The group shall be on a port kept clocked in Sleep and Deep-Sleep modes
+*              (MCU_SLEEP_GPIO_CLOCK_GATING/MCU_DEEP_SLEEP_GPIO_CLOCK_GATING), the other groups
+*              are rejected with DIO_E_PARAM_INVALID_GROUP.
+************************************************************************************/
+Std_ReturnType Dio_WriteSequence(const Dio_ChannelGroupType * ChannelGroupIdPtr, const Dio_PortLevelType * SamplesPtr,
+                                 uint16 NumberOfSamples, uint32 SamplePeriod)
+{
+	Std_ReturnType result = E_NOT_OK;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_SEQUENCE_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/*
+	 * Check if the input pointers are not NULL_PTR and if the group port stays clocked while the CPU sleeps,
+	 * an unclocked port would fault the uDMA, so these checks are kept without the development error detection
+	 */
+	if ((NULL_PTR == ChannelGroupIdPtr) || (NULL_PTR == SamplesPtr))
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_SEQUENCE_SID, DIO_E_PARAM_POINTER);
+#endif
+		error = TRUE;
+	}
+	else if (0U == (DIO_SEQUENCE_CLOCKED_PORTS & (1U << ChannelGroupIdPtr->PortIndex)))
+	{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_SEQUENCE_SID, DIO_E_PARAM_INVALID_GROUP);
+#endif
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the sequence fits in one uDMA transfer and the period is not zero */
+	if ((0U == NumberOfSamples) || (DMA_MAX_TRANSFER_SIZE < NumberOfSamples) || (0U == SamplePeriod))
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_WRITE_SEQUENCE_SID, DIO_E_PARAM_INVALID_SEQUENCE);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+		if(TRUE == Dma_IsTransferDone(DIO_SEQUENCE_DMA_CHANNEL))
+		{
+			/* Arm the uDMA before the timer, so the first request already finds the channel enabled */
+			Gpt_StopDmaTrigger();
+			Dma_StartTransfer(DIO_SEQUENCE_DMA_CHANNEL, SamplesPtr,
+			                  &DIO_PORT_DATA(ChannelGroupIdPtr->PortIndex,ChannelGroupIdPtr->mask),
+			                  NumberOfSamples);
+			Gpt_StartDmaTrigger(SamplePeriod);
+			Dio_SequenceGroup = ChannelGroupIdPtr;
+			result = E_OK;
+		}
+		else
+		{
+			/* No Action Required ... the previous sequence is still running */
+		}
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return result;
+}
+
+/************************************************************************************
+* Service Name: Dio_IsSequenceDone
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the last sequence is finished (or no sequence is started)
+* Description: Function to check the end of the last sequence, the pacing timer is stopped
+*              once all the samples are written.
+************************************************************************************/
+boolean Dio_IsSequenceDone(void)
+{
+	boolean done = Dma_IsTransferDone(DIO_SEQUENCE_DMA_CHANNEL);
+
+	if(TRUE == done)
+	{
+		Gpt_StopDmaTrigger();
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		/* The uDMA does not update the shadow, the group pins keep the last sample of the sequence */
+		if(NULL_PTR != Dio_SequenceGroup)
+		{
+			DIO_SHADOW_WRITE_MASKED(Dio_SequenceGroup->PortIndex,Dio_SequenceGroup->mask,
+			                        DIO_PORT_DATA(Dio_SequenceGroup->PortIndex,Dio_SequenceGroup->mask));
+			Dio_SequenceGroup = NULL_PTR;
+		}
+		else
+		{
+			/* No Action Required */
+		}
+#endif
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	return done;
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_GetVersionInfo
+* Service ID[hex]: 0x12
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (DIO_VERSION_INFO_API == STD_ON)
+void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if input pointer is not Null pointer */
+	if(NULL_PTR == versioninfo)
+	{
+		/* Report to DET  */
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_GET_VERSION_INFO_SID, DIO_E_PARAM_POINTER);
+	}
+	else
+#endif /* (DIO_DEV_ERROR_DETECT == STD_ON) */
+	{
+		/* Copy the vendor Id */
+		versioninfo->vendorID = (uint16)DIO_VENDOR_ID;
+		/* Copy the module Id */
+		versioninfo->moduleID = (uint16)DIO_MODULE_ID;
+		/* Copy Software Major Version */
+		versioninfo->sw_major_version = (uint8)DIO_SW_MAJOR_VERSION;
+		/* Copy Software Minor Version */
+		versioninfo->sw_minor_version = (uint8)DIO_SW_MINOR_VERSION;
+		/* Copy Software Patch Version */
+		versioninfo->sw_patch_version = (uint8)DIO_SW_PATCH_VERSION;
+	}
+}
+#endif
+
+/************************************************************************************
+* Service Name: Dio_FlipChannel
+* Service ID[hex]: 0x11
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelId - ID of DIO channel.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: Dio_LevelType
+* Description: Function to flip the level of a channel and return the level of the channel after flip.
+************************************************************************************/
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+RAM_FUNC Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+{
+	Dio_LevelType output = STD_LOW;
+	boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+	/* Check if the Driver is initialized before using this function */
+	if (DIO_NOT_INITIALIZED == Dio_Status)
+	{
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_UNINIT);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+	/* Check if the used channel is within the valid range */
+	if (DIO_CONFIGURED_CHANNLES <= ChannelId)
+	{
+
+		Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+				DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+		error = TRUE;
+	}
+	else
+	{
+		/* No Action Required */
+	}
+#endif
+
+	/* In-case there are no errors */
+	if(FALSE == error)
+	{
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		/* The current level of an output comes from the shadow, so the flip is a single store */
+		Dio_LevelType level = DIO_CHANNEL_IS_OUTPUT(ChannelId) ? DIO_SHADOW_READ_CHANNEL(ChannelId)
+		                    : ((*Dio_ChannelAccess[ChannelId].Data != 0) ? STD_HIGH : STD_LOW);
+#else
+		/* Read the required channel through the masked address */
+		Dio_LevelType level = (*Dio_ChannelAccess[ChannelId].Data != 0) ? STD_HIGH : STD_LOW;
+#endif
+		if(STD_HIGH == level)
+		{
+			*Dio_ChannelAccess[ChannelId].Data = 0;
+			output = STD_LOW;
+		}
+		else
+		{
+			*Dio_ChannelAccess[ChannelId].Data = Dio_ChannelAccess[ChannelId].Bit;
+			output = STD_HIGH;
+		}
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+		DIO_SHADOW_WRITE_CHANNEL(ChannelId,output);
+#endif
 	}
 	else
 	{
@@ -72,6 +72,11 @@
 /* Non AUTOSAR files */
 #include "Common_Macros.h"
 
+#if (DIO_WRITE_SEQUENCE_API == STD_ON)
+/* uDMA channels and maximum transfer size used by Dio_WriteSequence */
+#include "Dma.h"
+#endif
+
 /******************************************************************************
  *                      API Service Id Macros                                 *
  ******************************************************************************/
@@ -102,6 +107,31 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO write Channel Batch (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNEL_BATCH_SID    (uint8)0x13
+
+/* Service ID for DIO write Output Set (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_OUTPUT_SET_SID       (uint8)0x14
+
+/* Service IDs for DIO Process Image APIs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_LATCH_IMAGE_SID            (uint8)0x15
+#define DIO_FLUSH_IMAGE_SID            (uint8)0x16
+#define DIO_READ_CHANNEL_IMAGE_SID     (uint8)0x17
+#define DIO_WRITE_CHANNEL_IMAGE_SID    (uint8)0x18
+#define DIO_FLIP_CHANNEL_IMAGE_SID     (uint8)0x19
+#define DIO_READ_PORT_IMAGE_SID        (uint8)0x1F
+
+/* Service IDs for DIO Edge Notification APIs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_GET_EDGE_EVENT_SID         (uint8)0x1A
+#define DIO_EDGE_MAIN_FUNCTION_SID     (uint8)0x1B
+
+/* Service ID for DIO write Sequence (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_SEQUENCE_SID         (uint8)0x1C
+
+/* Service IDs for DIO Output Shadow APIs (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_REFRESH_OUTPUTS_SID        (uint8)0x1D
+#define DIO_VERIFY_OUTPUTS_SID         (uint8)0x1E
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -123,6 +153,12 @@
  */
 #define DIO_E_PARAM_POINTER             (uint8)0x20
 
+/* DET code to report Invalid Output Set (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_E_PARAM_INVALID_OUTPUT_SET  (uint8)0x21
+
+/* DET code to report Invalid Sequence length or period (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_E_PARAM_INVALID_SEQUENCE    (uint8)0x22
+
 /*
  * API service used without module initialization is reported using following
  * error code (Not exist in AUTOSAR 4.0.3 DIO SWS Document.
@@ -144,6 +180,29 @@ typedef uint8 Dio_LevelType;
 /* Type definition for Dio_PortLevelType used by the DIO APIs */
 typedef uint8 Dio_PortLevelType;
 
+/* Type definition for Dio_EdgeType used by the edge notifications configuration */
+typedef uint8 Dio_EdgeType;
+
+/* Channel edges detected by the port interrupt */
+#define DIO_EDGE_NONE                  (Dio_EdgeType)0x00
+#define DIO_EDGE_RISING                (Dio_EdgeType)0x01
+#define DIO_EDGE_FALLING               (Dio_EdgeType)0x02
+#define DIO_EDGE_BOTH                  (Dio_EdgeType)0x03
+
+/* Type definition for the edge notification called from the port interrupt (ChannelId, Level, TimeStamp) */
+typedef void (*Dio_EdgeNotificationType)(Dio_ChannelType ChannelId, Dio_LevelType Level, uint32 TimeStamp);
+
+/* Structure for one edge event queued by the port interrupt */
+typedef struct
+{
+	/* Member contains the ID of the channel */
+	Dio_ChannelType ChannelId;
+	/* Member contains the level of the channel after the edge */
+	Dio_LevelType Level;
+	/* Member contains the Gpt time stamp of the interrupt */
+	uint32 TimeStamp;
+} Dio_EdgeEventType;
+
 /* Structure for Dio_ChannelGroup */
 typedef struct
 {
@@ -161,33 +220,109 @@ typedef struct
 	Dio_PortType Port_Num;
 	/* Member contains the ID of the Channel*/
 	Dio_ChannelType Ch_Num;
+	/* Member contains the edges notified by the port interrupt */
+	Dio_EdgeType Edge;
+	/* Member contains the function called from the port interrupt at each edge, or NULL_PTR */
+	Dio_EdgeNotificationType Notification;
 }Dio_ConfigChannel;
 
+/* Structure for a set of output channels written together by Dio_WriteOutputSet */
+typedef struct
+{
+	/* Member contains the IDs of the channels of the set */
+	Dio_ChannelType Channels[DIO_OUTPUT_SET_MAX_CHANNELS];
+	/* Member contains the number of the used entries in Channels */
+	uint8 NumberOfChannels;
+} Dio_OutputSetType;
+
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
 {
 	Dio_ConfigChannel Channels[DIO_CONFIGURED_CHANNLES];
+	Dio_ChannelGroupType Groups[DIO_CONFIGURED_GROUPS];
+	Dio_OutputSetType OutputSets[DIO_CONFIGURED_OUTPUT_SETS];
 } Dio_ConfigType;
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType * ChannelGroupIdPtr, Dio_PortLevelType Level);
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
+#if (DIO_WRITE_BATCH_API == STD_ON)
+/* Function for DIO write Channel Batch API */
+void Dio_WriteChannelBatch(const Dio_ChannelType * ChannelIdPtr, const Dio_LevelType * LevelPtr,
+                           uint8 NumberOfChannels);
+
+/* Function for DIO write Output Set API */
+void Dio_WriteOutputSet(uint8 OutputSetId, const Dio_LevelType * LevelPtr);
+#endif
+
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+/* Function to latch all the configured pins in the process image (start of the Os tick) */
+void Dio_LatchImage(void);
+
+/* Function to write the changed outputs of the process image to the ports (end of the Os tick) */
+void Dio_FlushImage(void);
+
+/* Function to read the level of a channel from the process image */
+Dio_LevelType Dio_ReadChannelImage(Dio_ChannelType ChannelId);
+
+/* Function to write the level of a channel in the process image */
+void Dio_WriteChannelImage(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Function to flip the level of a channel in the process image */
+Dio_LevelType Dio_FlipChannelImage(Dio_ChannelType ChannelId);
+
+/* Function to read the levels of the configured channels of a port from the process image */
+Dio_PortLevelType Dio_ReadPortImage(Dio_PortType PortId);
+#endif
+
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+/* Function to get the oldest queued edge event, returns FALSE if the queue is empty */
+boolean Dio_GetEdgeEvent(Dio_EdgeEventType * EventPtr);
+
+/* Function to refill the edge budget of each channel and enable the rate limited channels (every Os tick) */
+void Dio_EdgeMainFunction(void);
+#endif
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/* Function to write the shadow of the output pins with one masked store per port */
+void Dio_RefreshOutputs(void);
+
+/* Function to compare the output pins with their shadow, returns the mask of the ports with a mismatch */
+uint8 Dio_VerifyOutputs(void);
+#endif
+
+#if (DIO_WRITE_SEQUENCE_API == STD_ON)
+/* Function to start writing a sequence of port levels to a channel group, paced by the timer and the uDMA
+   (only the groups of DIO_SEQUENCE_GROUPS_LIST, on the ports clocked in Sleep and Deep-Sleep modes, see Mcu_Cfg.h) */
+Std_ReturnType Dio_WriteSequence(const Dio_ChannelGroupType * ChannelGroupIdPtr, const Dio_PortLevelType * SamplesPtr,
+                                 uint16 NumberOfSamples, uint32 SamplePeriod);
+
+/* Function to check if the last sequence is finished, it stops the pacing timer once the sequence is done */
+boolean Dio_IsSequenceDone(void);
+#endif
+
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 /* Function for DIO flip channel API */
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
@@ -198,6 +333,184 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
+#if (DIO_PRE_COMPILE_CHANNELS_API == STD_ON)
+
+#include "Dio_Regs.h"
+
+/* Data register of a channel accessed through the address masked to its pin */
+#define DIO_CHANNEL_DATA(PORT_ID,PIN) \
+    (*(volatile uint32 *)(DIO_PORT_BASE_ADDRESS(PORT_ID) + DIO_DATA_MASKED_OFFSET(1U << (PIN))))
+
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+/* Output shadow of each port, only to be updated by the compile-time accessors outside Dio.c */
+extern volatile uint32 Dio_OutputShadow[];
+
+/* Output pins of the configured channels in each port, served by the shadow (none before Dio_Init) */
+extern uint8 Dio_ShadowMask[];
+
+/* The compile-time write accessors keep the output shadow up to date with one more single bit store */
+#define DIO_CHANNEL_SHADOW_WRITE(PORT_ID,PIN,LEVEL)   BITBAND_WRITE_BIT(Dio_OutputShadow[PORT_ID],PIN,(STD_HIGH == (LEVEL)))
+
+/* The level of an output is read from the shadow as Dio_ReadChannel does, the level of an input from its pin */
+#define DIO_CHANNEL_READ(PORT_ID,PIN) \
+    ((0U != (Dio_ShadowMask[PORT_ID] & (1U << (PIN)))) ? (Dio_OutputShadow[PORT_ID] & (1U << (PIN))) \
+                                                      : DIO_CHANNEL_DATA(PORT_ID,PIN))
+#else
+#define DIO_CHANNEL_SHADOW_WRITE(PORT_ID,PIN,LEVEL)
+#define DIO_CHANNEL_READ(PORT_ID,PIN)                 DIO_CHANNEL_DATA(PORT_ID,PIN)
+#endif
+
+/*
+ * Compile-time accessors of one configured channel: a single store to write, a single load to read.
+ * They have no DET checks as the channel is checked at compile time, the levels are the ones of the runtime
+ * services (the outputs are read from the shadow once Dio_Init is done).
+ */
+#define DIO_DEFINE_CHANNEL_ACCESSORS(NAME,PORT_ID,PIN) \
+LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level) \
+{ \
+    DIO_CHANNEL_DATA(PORT_ID,PIN) = (STD_HIGH == Level) ? (1U << (PIN)) : 0U; \
+    DIO_CHANNEL_SHADOW_WRITE(PORT_ID,PIN,Level); \
+} \
+LOCAL_INLINE Dio_LevelType Dio_Read_##NAME(void) \
+{ \
+    return (DIO_CHANNEL_READ(PORT_ID,PIN) != 0U) ? STD_HIGH : STD_LOW; \
+} \
+LOCAL_INLINE Dio_LevelType Dio_Flip_##NAME(void) \
+{ \
+    Dio_LevelType level = (DIO_CHANNEL_READ(PORT_ID,PIN) != 0U) ? STD_LOW : STD_HIGH; \
+    Dio_Write_##NAME(level); \
+    return level; \
+}
+
+/* Generate the accessors of all the configured channels */
+DIO_CONFIGURED_CHANNELS_LIST(DIO_DEFINE_CHANNEL_ACCESSORS)
+
+/* Cases selecting the accessor of a configured channel by its index in the PB configuration */
+#define DIO_WRITE_CHANNEL_CASE(NAME,PORT_ID,PIN) \
+    case DioConf_##NAME##_CHANNEL_ID_INDEX: Dio_Write_##NAME(Level); break;
+#define DIO_READ_CHANNEL_CASE(NAME,PORT_ID,PIN) \
+    case DioConf_##NAME##_CHANNEL_ID_INDEX: level = Dio_Read_##NAME(); break;
+#define DIO_FLIP_CHANNEL_CASE(NAME,PORT_ID,PIN) \
+    case DioConf_##NAME##_CHANNEL_ID_INDEX: level = Dio_Flip_##NAME(); break;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+
+/* Driver state of Dio.c */
+extern uint8 Dio_Status;
+#endif
+
+/* Function to report DIO_E_UNINIT for a channel service called before Dio_Init, as the runtime services do */
+LOCAL_INLINE boolean Dio_ConstChannelInitialized(uint8 ApiId)
+{
+    boolean initialized = TRUE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, ApiId, DIO_E_UNINIT);
+        initialized = FALSE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#else
+    (void)ApiId;
+#endif
+    return initialized;
+}
+
+/*
+ * Channel services for a compile-time constant channel ID: the switch is folded to the accessor of the channel,
+ * they are only called by the routing macros below after the channel ID is checked at compile time.
+ */
+LOCAL_INLINE void Dio_WriteConstChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    if(TRUE == Dio_ConstChannelInitialized(DIO_WRITE_CHANNEL_SID))
+    {
+        switch(ChannelId)
+        {
+        DIO_CONFIGURED_CHANNELS_LIST(DIO_WRITE_CHANNEL_CASE)
+        default:
+            /* Not reachable ... invalid channel IDs fail the build */
+            break;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+LOCAL_INLINE Dio_LevelType Dio_ReadConstChannel(Dio_ChannelType ChannelId)
+{
+    Dio_LevelType level = STD_LOW;
+
+    if(TRUE == Dio_ConstChannelInitialized(DIO_READ_CHANNEL_SID))
+    {
+        switch(ChannelId)
+        {
+        DIO_CONFIGURED_CHANNELS_LIST(DIO_READ_CHANNEL_CASE)
+        default:
+            /* Not reachable ... invalid channel IDs fail the build */
+            break;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return level;
+}
+
+LOCAL_INLINE Dio_LevelType Dio_FlipConstChannel(Dio_ChannelType ChannelId)
+{
+    Dio_LevelType level = STD_LOW;
+
+    if(TRUE == Dio_ConstChannelInitialized(DIO_FLIP_CHANNEL_SID))
+    {
+        switch(ChannelId)
+        {
+        DIO_CONFIGURED_CHANNELS_LIST(DIO_FLIP_CHANNEL_CASE)
+        default:
+            /* Not reachable ... invalid channel IDs fail the build */
+            break;
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return level;
+}
+
+/*
+ * Routing of the channel services by their channel ID:
+ * - A compile-time constant ID (DioConf_<Name>_CHANNEL_ID_INDEX) is checked against DIO_CONFIGURED_CHANNLES at
+ *   compile time, the build fails for an invalid ID, and the call is inlined to the accessor of the channel. Only
+ *   the DIO_E_UNINIT check is kept at runtime (with DIO_DEV_ERROR_DETECT), so the behaviour is the runtime one.
+ * - An ID only known at runtime calls the service in Dio.c with its DET checks.
+ */
+#define Dio_WriteChannel(ChannelId,Level) \
+    (COMPILE_TIME_CONSTANT(ChannelId) \
+        ? (COMPILE_TIME_CHECK(ChannelId, DIO_CONFIGURED_CHANNLES > (ChannelId)), Dio_WriteConstChannel((ChannelId),(Level))) \
+        : Dio_WriteChannel((ChannelId),(Level)))
+
+#define Dio_ReadChannel(ChannelId) \
+    (COMPILE_TIME_CONSTANT(ChannelId) \
+        ? (COMPILE_TIME_CHECK(ChannelId, DIO_CONFIGURED_CHANNLES > (ChannelId)), Dio_ReadConstChannel(ChannelId)) \
+        : Dio_ReadChannel(ChannelId))
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+#define Dio_FlipChannel(ChannelId) \
+    (COMPILE_TIME_CONSTANT(ChannelId) \
+        ? (COMPILE_TIME_CHECK(ChannelId, DIO_CONFIGURED_CHANNLES > (ChannelId)), Dio_FlipConstChannel(ChannelId)) \
+        : Dio_FlipChannel(ChannelId))
+#endif
+
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
@@ -205,4 +518,11 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /* Extern PB structures to be used by Dio and other modules */
 extern const Dio_ConfigType Dio_Configuration;
 
+/* Symbolic names of the configured Channel Groups to be passed to the Channel Group APIs */
+#define DioConf_RGB_LEDS_GROUP_PTR           (&Dio_Configuration.Groups[DioConf_RGB_LEDS_GROUP_ID_INDEX])
+#define DioConf_KEYPAD_ROWS_GROUP_PTR        (&Dio_Configuration.Groups[DioConf_KEYPAD_ROWS_GROUP_ID_INDEX])
+#define DioConf_KEYPAD_COLUMNS_GROUP_PTR     (&Dio_Configuration.Groups[DioConf_KEYPAD_COLUMNS_GROUP_ID_INDEX])
+#define DioConf_DISPLAY_SEGMENTS_GROUP_PTR   (&Dio_Configuration.Groups[DioConf_DISPLAY_SEGMENTS_GROUP_ID_INDEX])
+#define DioConf_DISPLAY_DIGITS_GROUP_PTR     (&Dio_Configuration.Groups[DioConf_DISPLAY_DIGITS_GROUP_ID_INDEX])
+
 #endif /* DIO_H */
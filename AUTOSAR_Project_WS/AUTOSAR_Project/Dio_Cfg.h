@@ -35,19 +35,141 @@
 /* Pre-compile option for presence of Dio_FlipChannel API */
 #define DIO_FLIP_CHANNEL_API                (STD_ON)
 
+/*
+ * Pre-compile option for the compile-time channel accessors Dio_Write_<Name>, Dio_Read_<Name> and Dio_Flip_<Name>
+ * generated for each channel of DIO_CONFIGURED_CHANNELS_LIST. The port and pin are constants, so each accessor is
+ * inlined to a single masked GPIODATA access without the PB configuration lookup and the DET checks.
+ * Dio_ReadChannel, Dio_WriteChannel and Dio_FlipChannel calls with a compile-time constant channel ID are routed to
+ * these accessors, the channel ID is then checked at compile time and only the DIO_E_UNINIT check is kept.
+ */
+#define DIO_PRE_COMPILE_CHANNELS_API        (STD_ON)
+
 /* Number of the configured Dio Channels */
-#define DIO_CONFIGURED_CHANNLES              (2U)
+#define DIO_CONFIGURED_CHANNLES              (4U)
 
 /* Channel Index in the array of structures in Dio_PBcfg.c */
 #define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
+#define DioConf_LED_BLUE_CHANNEL_ID_INDEX    (uint8)0x02
+#define DioConf_LED_GREEN_CHANNEL_ID_INDEX   (uint8)0x03
 
 /* DIO Configured Port ID's  */
 #define DioConf_LED1_PORT_NUM                (Dio_PortType)5 /* PORTF */
 #define DioConf_SW1_PORT_NUM                 (Dio_PortType)5 /* PORTF */
+#define DioConf_LED_BLUE_PORT_NUM            (Dio_PortType)5 /* PORTF */
+#define DioConf_LED_GREEN_PORT_NUM           (Dio_PortType)5 /* PORTF */
+
+/* DIO Configured Channel Edges ... DIO_EDGE_NONE, DIO_EDGE_RISING, DIO_EDGE_FALLING or DIO_EDGE_BOTH */
+#define DioConf_LED1_EDGE                    DIO_EDGE_NONE
+#define DioConf_SW1_EDGE                     DIO_EDGE_BOTH /* Press (falling) and release (rising) */
+#define DioConf_LED_BLUE_EDGE                DIO_EDGE_NONE
+#define DioConf_LED_GREEN_EDGE               DIO_EDGE_NONE
+
+/* DIO Configured Channel Edge Notifications called from the port interrupt ... NULL_PTR for none */
+#define DioConf_LED1_NOTIFICATION            NULL_PTR
+#define DioConf_SW1_NOTIFICATION             Button_EdgeNotification /* SW1 hybrid debounce */
+#define DioConf_LED_BLUE_NOTIFICATION        NULL_PTR
+#define DioConf_LED_GREEN_NOTIFICATION       NULL_PTR
 
 /* DIO Configured Channel ID's */
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
+#define DioConf_LED_BLUE_CHANNEL_NUM         (Dio_ChannelType)2 /* Pin 2 in PORTF */
+#define DioConf_LED_GREEN_CHANNEL_NUM        (Dio_ChannelType)3 /* Pin 3 in PORTF */
+
+/* List of the configured channels used to generate the compile-time accessors: CHANNEL(Name, Port, Pin) */
+#define DIO_CONFIGURED_CHANNELS_LIST(CHANNEL) \
+    CHANNEL(LED1, DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM) \
+    CHANNEL(SW1,  DioConf_SW1_PORT_NUM,  DioConf_SW1_CHANNEL_NUM) \
+    CHANNEL(LED_BLUE,  DioConf_LED_BLUE_PORT_NUM,  DioConf_LED_BLUE_CHANNEL_NUM) \
+    CHANNEL(LED_GREEN, DioConf_LED_GREEN_PORT_NUM, DioConf_LED_GREEN_CHANNEL_NUM)
+
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (5U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LEDS_GROUP_ID_INDEX      (uint8)0x00
+#define DioConf_KEYPAD_ROWS_GROUP_ID_INDEX   (uint8)0x01
+#define DioConf_KEYPAD_COLUMNS_GROUP_ID_INDEX (uint8)0x02
+#define DioConf_DISPLAY_SEGMENTS_GROUP_ID_INDEX (uint8)0x03
+#define DioConf_DISPLAY_DIGITS_GROUP_ID_INDEX (uint8)0x04
+
+/* DIO Configured Channel Groups: PORTF Pin1 (Red), Pin2 (Blue) and Pin3 (Green) */
+#define DioConf_RGB_LEDS_PORT_NUM            (Dio_PortType)5 /* PORTF */
+#define DioConf_RGB_LEDS_GROUP_MASK          (uint8)0x0E     /* Pins 1..3 in PORTF */
+#define DioConf_RGB_LEDS_GROUP_OFFSET        (uint8)1
+
+/* DIO Configured Channel Groups: keypad rows on PORTE Pin0..3 (open drain) and columns on PORTC Pin4..7 */
+#define DioConf_KEYPAD_ROWS_PORT_NUM         (Dio_PortType)4 /* PORTE */
+#define DioConf_KEYPAD_ROWS_GROUP_MASK       (uint8)0x0F     /* Pins 0..3 in PORTE */
+#define DioConf_KEYPAD_ROWS_GROUP_OFFSET     (uint8)0
+#define DioConf_KEYPAD_COLUMNS_PORT_NUM      (Dio_PortType)2 /* PORTC */
+#define DioConf_KEYPAD_COLUMNS_GROUP_MASK    (uint8)0xF0     /* Pins 4..7 in PORTC */
+#define DioConf_KEYPAD_COLUMNS_GROUP_OFFSET  (uint8)4
+
+/* DIO Configured Channel Groups: display segments a..g, dp on PORTB Pin0..7 and digit selects on PORTA Pin2..5 */
+#define DioConf_DISPLAY_SEGMENTS_PORT_NUM    (Dio_PortType)1 /* PORTB */
+#define DioConf_DISPLAY_SEGMENTS_GROUP_MASK  (uint8)0xFF     /* Pins 0..7 in PORTB */
+#define DioConf_DISPLAY_SEGMENTS_GROUP_OFFSET (uint8)0
+#define DioConf_DISPLAY_DIGITS_PORT_NUM      (Dio_PortType)0 /* PORTA */
+#define DioConf_DISPLAY_DIGITS_GROUP_MASK    (uint8)0x3C     /* Pins 2..5 in PORTA */
+#define DioConf_DISPLAY_DIGITS_GROUP_OFFSET  (uint8)2
+
+/* Pre-compile option for presence of Dio_WriteChannelBatch and Dio_WriteOutputSet APIs */
+#define DIO_WRITE_BATCH_API                  (STD_ON)
+
+/*
+ * Pre-compile option for the process image APIs: all the configured pins are latched once per Os tick
+ * by Dio_LatchImage, the tasks read and write the RAM image and Dio_FlushImage writes the changed outputs.
+ */
+#define DIO_PROCESS_IMAGE_API                (STD_ON)
+
+/*
+ * Pre-compile option for the edge notifications: the configured channel edges are detected by the port
+ * interrupt which queues time stamped edge events, the events are processed at task level.
+ */
+#define DIO_EDGE_NOTIFICATION_API            (STD_ON)
+
+/* Size of the edge events queue (power of 2, up to 128) */
+#define DIO_EDGE_QUEUE_SIZE                  (16U)
+
+/*
+ * Rate limit: maximum number of edge events of one channel between two Dio_EdgeMainFunction calls (Os tick).
+ * The channel interrupt is masked when its budget is consumed and enabled again by Dio_EdgeMainFunction.
+ */
+#define DIO_EDGE_MAX_EVENTS_PER_TICK         (4U)
+
+/*
+ * Pre-compile option for the output shadow: the last level written to each output pin is kept in RAM.
+ * The output levels are read from the shadow, Dio_RefreshOutputs writes the shadow with one store per port
+ * and Dio_VerifyOutputs compares the shadow with the pins to detect the stuck or overwritten outputs.
+ */
+#define DIO_OUTPUT_SHADOW_API                (STD_ON)
+
+/*
+ * Pre-compile option for presence of Dio_WriteSequence API: a sequence of port levels is written to the pins
+ * of a channel group by the uDMA, one sample per time-out of the pacing timer (Timer1A), without the CPU.
+ */
+#define DIO_WRITE_SEQUENCE_API               (STD_ON)
+
+/* uDMA channel requested by the pacing timer of Dio_WriteSequence */
+#define DIO_SEQUENCE_DMA_CHANNEL             DMA_TIMER1A_CHANNEL
+
+/*
+ * Channel groups written by Dio_WriteSequence: GROUP(Name). Their ports shall stay clocked in Sleep and Deep-Sleep
+ * (see Mcu_Cfg.h), this is checked at compile time.
+ */
+#define DIO_SEQUENCE_GROUPS_LIST(GROUP) \
+    GROUP(RGB_LEDS)
+
+/* Number of the configured Dio Output Sets and the maximum number of channels in one set */
+#define DIO_CONFIGURED_OUTPUT_SETS           (1U)
+#define DIO_OUTPUT_SET_MAX_CHANNELS          (3U)
+
+/* Output Set Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LEDS_OUTPUT_SET_ID_INDEX (uint8)0x00
+
+/* DIO Configured Output Sets: Red (LED1), Blue and Green channels updated together */
+#define DioConf_RGB_LEDS_OUTPUT_SET_SIZE     (uint8)3
 
 #endif /* DIO_CFG_H */
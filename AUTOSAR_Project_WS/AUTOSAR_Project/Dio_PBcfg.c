@@ -11,6 +11,9 @@
 
 #include "Dio.h"
 
+/* Edge notifications of the upper layers */
+#include "Button.h"
+
 /*
  * Module Version 1.0.0
  */
@@ -41,6 +44,15 @@
 
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,
-				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM
+                                             DioConf_LED1_PORT_NUM,DioConf_LED1_CHANNEL_NUM,DioConf_LED1_EDGE,DioConf_LED1_NOTIFICATION,
+				                             DioConf_SW1_PORT_NUM,DioConf_SW1_CHANNEL_NUM,DioConf_SW1_EDGE,DioConf_SW1_NOTIFICATION,
+				                             DioConf_LED_BLUE_PORT_NUM,DioConf_LED_BLUE_CHANNEL_NUM,DioConf_LED_BLUE_EDGE,DioConf_LED_BLUE_NOTIFICATION,
+				                             DioConf_LED_GREEN_PORT_NUM,DioConf_LED_GREEN_CHANNEL_NUM,DioConf_LED_GREEN_EDGE,DioConf_LED_GREEN_NOTIFICATION,
+				                             DioConf_RGB_LEDS_GROUP_MASK,DioConf_RGB_LEDS_GROUP_OFFSET,DioConf_RGB_LEDS_PORT_NUM,
+				                             DioConf_KEYPAD_ROWS_GROUP_MASK,DioConf_KEYPAD_ROWS_GROUP_OFFSET,DioConf_KEYPAD_ROWS_PORT_NUM,
+				                             DioConf_KEYPAD_COLUMNS_GROUP_MASK,DioConf_KEYPAD_COLUMNS_GROUP_OFFSET,DioConf_KEYPAD_COLUMNS_PORT_NUM,
+				                             DioConf_DISPLAY_SEGMENTS_GROUP_MASK,DioConf_DISPLAY_SEGMENTS_GROUP_OFFSET,DioConf_DISPLAY_SEGMENTS_PORT_NUM,
+				                             DioConf_DISPLAY_DIGITS_GROUP_MASK,DioConf_DISPLAY_DIGITS_GROUP_OFFSET,DioConf_DISPLAY_DIGITS_PORT_NUM,
+				                             DioConf_LED1_CHANNEL_ID_INDEX,DioConf_LED_BLUE_CHANNEL_ID_INDEX,DioConf_LED_GREEN_CHANNEL_ID_INDEX,
+				                             DioConf_RGB_LEDS_OUTPUT_SET_SIZE
 				                         };
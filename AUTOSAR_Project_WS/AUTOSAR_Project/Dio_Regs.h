@@ -14,11 +14,31 @@
 
 #include "Std_Types.h"
 
-#define GPIO_PORTA_DATA_REG       (*((volatile uint32 *)0x400043FC))
-#define GPIO_PORTB_DATA_REG       (*((volatile uint32 *)0x400053FC))
-#define GPIO_PORTC_DATA_REG       (*((volatile uint32 *)0x400063FC))
-#define GPIO_PORTD_DATA_REG       (*((volatile uint32 *)0x400073FC))
-#define GPIO_PORTE_DATA_REG       (*((volatile uint32 *)0x400243FC))
-#define GPIO_PORTF_DATA_REG       (*((volatile uint32 *)0x400253FC))
+/* GPIO Registers base addresses in the aperture selected by the Mcu Driver */
+#include "Gpio_Regs.h"
+
+/* GPIO direction register offset address */
+#define DIO_GPIO_DIR_REG_OFFSET           0x400
+
+/* GPIO interrupt registers offset addresses */
+#define DIO_GPIO_IS_REG_OFFSET            0x404
+#define DIO_GPIO_IBE_REG_OFFSET           0x408
+#define DIO_GPIO_IEV_REG_OFFSET           0x40C
+#define DIO_GPIO_IM_REG_OFFSET            0x410
+#define DIO_GPIO_RIS_REG_OFFSET           0x414
+#define DIO_GPIO_MIS_REG_OFFSET           0x418
+#define DIO_GPIO_ICR_REG_OFFSET           0x41C
+
+/*
+ * GPIODATA address mask: the address bits [9:2] select the pins affected by an access,
+ * a read returns 0 for the unselected pins and a write does not change them.
+ */
+#define DIO_DATA_MASKED_OFFSET(MASK)      ((uint32)(MASK) << 2)
+
+/* Base address of a port from its Port Id ... a constant expression when the Port Id is a constant */
+#define DIO_PORT_BASE_ADDRESS(PORT_ID) \
+    ((0U == (PORT_ID)) ? GPIO_PORTA_BASE_ADDRESS : (1U == (PORT_ID)) ? GPIO_PORTB_BASE_ADDRESS : \
+     (2U == (PORT_ID)) ? GPIO_PORTC_BASE_ADDRESS : (3U == (PORT_ID)) ? GPIO_PORTD_BASE_ADDRESS : \
+     (4U == (PORT_ID)) ? GPIO_PORTE_BASE_ADDRESS : GPIO_PORTF_BASE_ADDRESS)
 
 #endif /* DIO_REGS_H */
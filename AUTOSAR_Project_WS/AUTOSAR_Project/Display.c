@@ -0,0 +1,159 @@
+/******************************************************************************
+ *
+ * Module: Display
+ *
+ * File Name: Display.c
+ *
+ * Description: Source file for Display Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Dio.h"
+#include "Dma.h"
+#include "Gpt.h"
+#include "Display.h"
+
+#if (DISPLAY_DIGITS < 1U) || (DISPLAY_DIGITS > 8U)
+  #error "The display shall have 1 --> 8 digits"
+#endif
+
+#if (DISPLAY_REFRESH_RATE_HZ < 1U) || ((MCU_RUN_CLOCK_FREQ_HZ / (DISPLAY_REFRESH_RATE_HZ * DISPLAY_DIGITS)) < 64U)
+  #error "The display refresh rate is out of range"
+#endif
+
+/* The uDMA refreshes the display during the Os idle sleep, the ports of both groups shall stay clocked */
+#define DISPLAY_SLEEP_CLOCKED_PORTS    (MCU_SLEEP_GPIO_CLOCK_GATING & MCU_DEEP_SLEEP_GPIO_CLOCK_GATING)
+STATIC_ASSERT(0U != (DISPLAY_SLEEP_CLOCKED_PORTS & (1U << DioConf_DISPLAY_SEGMENTS_PORT_NUM)), Display_SegmentsPortGatedInSleep);
+STATIC_ASSERT(0U != (DISPLAY_SLEEP_CLOCKED_PORTS & (1U << DioConf_DISPLAY_DIGITS_PORT_NUM)), Display_DigitsPortGatedInSleep);
+
+/* Time between two refresh requests, each request lights the next digit */
+#define DISPLAY_DIGIT_PERIOD           (MCU_RUN_CLOCK_FREQ_HZ / (DISPLAY_REFRESH_RATE_HZ * DISPLAY_DIGITS))
+
+/* Tasks of one digit: digits off, segments of the digit, then select the digit */
+#define DISPLAY_TASKS_PER_DIGIT        (3U)
+#define DISPLAY_TASKS                  (DISPLAY_TASKS_PER_DIGIT * DISPLAY_DIGITS)
+
+/* Port level of the segments group for a segments bitmap */
+#if (DISPLAY_SEGMENT_ACTIVE_LEVEL == STD_HIGH)
+#define DISPLAY_SEGMENTS_LEVEL(SEGMENTS)  (uint8)(SEGMENTS)
+#else
+#define DISPLAY_SEGMENTS_LEVEL(SEGMENTS)  (uint8)(~(SEGMENTS))
+#endif
+
+/*
+ * Port levels of the digits group with all the digits off and with one digit selected, the masked store of
+ * the group ignores the bits of the other pins of the port.
+ */
+#if (DISPLAY_DIGIT_ACTIVE_LEVEL == STD_HIGH)
+#define DISPLAY_DIGITS_OFF_LEVEL       (uint8)0x00
+#define DISPLAY_DIGIT_LEVEL(DIGIT)     (uint8)(1U << (DIGIT))
+#else
+#define DISPLAY_DIGITS_OFF_LEVEL       (uint8)0xFF
+#define DISPLAY_DIGIT_LEVEL(DIGIT)     (uint8)(~(1U << (DIGIT)))
+#endif
+
+/* Segments of the hexadecimal digits 0 --> F */
+static const uint8 Display_Font[16] = {
+    0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,
+    0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71
+};
+
+/*
+ * Frame buffer: the segments port levels of each digit, read by the uDMA at each refresh of the digit.
+ * A single byte store updates a digit, so a digit is never shown half written.
+ */
+static volatile uint8 Display_FrameBuffer[DISPLAY_DIGITS];
+
+/* Segments bitmap of each digit, to keep the decimal point of Display_SetDigit */
+static uint8 Display_Segments[DISPLAY_DIGITS];
+
+/* Sources of the digit select tasks (constant after Display_Init), shifted to the position of the digits group */
+static uint8 Display_DigitsOff;
+static uint8 Display_DigitSelect[DISPLAY_DIGITS];
+
+/* uDMA task loop of the refresh, with the reload task and image appended by Dma_StartTaskLoop */
+static Dma_TaskType Display_Tasks[DMA_TASK_LOOP_ENTRIES(DISPLAY_TASKS)];
+
+/* Description: Clear the frame buffer and start the refresh, called once after Dma_Init and Dio_Init */
+void Display_Init(void)
+{
+    const Dio_ChannelGroupType * segments = DISPLAY_SEGMENTS_GROUP;
+    const Dio_ChannelGroupType * digits   = DISPLAY_DIGITS_GROUP;
+    volatile uint32 * segments_reg;
+    volatile uint32 * digits_reg;
+    uint8 digit;
+
+    /* Masked data addresses of the groups: a store changes the pins of the group only */
+    segments_reg = (volatile uint32 *)(DIO_PORT_BASE_ADDRESS(segments->PortIndex) + DIO_DATA_MASKED_OFFSET(segments->mask));
+    digits_reg   = (volatile uint32 *)(DIO_PORT_BASE_ADDRESS(digits->PortIndex) + DIO_DATA_MASKED_OFFSET(digits->mask));
+
+    Display_DigitsOff = (uint8)(DISPLAY_DIGITS_OFF_LEVEL << digits->offset);
+    *digits_reg = Display_DigitsOff;
+
+    for(digit = 0; digit < DISPLAY_DIGITS; digit++)
+    {
+        Dma_TaskType * tasks = &Display_Tasks[digit * DISPLAY_TASKS_PER_DIGIT];
+
+        Display_Segments[digit]    = 0;
+        Display_FrameBuffer[digit] = (uint8)(DISPLAY_SEGMENTS_LEVEL(0U) << segments->offset);
+        Display_DigitSelect[digit] = (uint8)(DISPLAY_DIGIT_LEVEL(digit) << digits->offset);
+
+        /*
+         * The first task of a digit waits for the timer, the two others follow at once: the digits are turned
+         * off before the segments change, so the previous digit never shows the segments of the next one.
+         */
+        Dma_SetByteTask(&tasks[0],&Display_DigitsOff,digits_reg,DMA_TASK_WAIT_REQUEST);
+        Dma_SetByteTask(&tasks[1],&Display_FrameBuffer[digit],segments_reg,DMA_TASK_IMMEDIATE);
+        Dma_SetByteTask(&tasks[2],&Display_DigitSelect[digit],digits_reg,DMA_TASK_IMMEDIATE);
+    }
+
+    Dma_StartTaskLoop(DISPLAY_DMA_CHANNEL,Display_Tasks,DISPLAY_TASKS);
+    Gpt_StartRefreshTrigger(DISPLAY_DIGIT_PERIOD);
+}
+
+/* Description: Stop the refresh and turn all the digits off */
+void Display_DeInit(void)
+{
+    Gpt_StopRefreshTrigger();
+    Dma_StopTransfer(DISPLAY_DMA_CHANNEL);
+    Dio_WriteChannelGroup(DISPLAY_DIGITS_GROUP,DISPLAY_DIGITS_OFF_LEVEL);
+}
+
+/* Description: Set the lit segments (DISPLAY_SEGMENT_x bits) of a digit, shown from the next refresh of the digit */
+void Display_SetSegments(uint8 Digit, uint8 Segments)
+{
+    if(Digit < DISPLAY_DIGITS)
+    {
+        Display_Segments[Digit]    = Segments;
+        Display_FrameBuffer[Digit] = (uint8)(DISPLAY_SEGMENTS_LEVEL(Segments) << DISPLAY_SEGMENTS_GROUP->offset);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Description: Show a hexadecimal value (0x0 --> 0xF) on a digit, the decimal point is kept */
+void Display_SetDigit(uint8 Digit, uint8 Value)
+{
+    if(Digit < DISPLAY_DIGITS)
+    {
+        Display_SetSegments(Digit,(uint8)((Display_Segments[Digit] & DISPLAY_SEGMENT_DP) | Display_Font[Value & 0x0FU]));
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Description: Turn off all the segments of all the digits */
+void Display_Clear(void)
+{
+    uint8 digit;
+
+    for(digit = 0; digit < DISPLAY_DIGITS; digit++)
+    {
+        Display_SetSegments(digit,0U);
+    }
+}
@@ -0,0 +1,47 @@
+/******************************************************************************
+ *
+ * Module: Display
+ *
+ * File Name: Display.h
+ *
+ * Description: Header file for Display Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include "Std_Types.h"
+#include "Display_Cfg.h"
+
+/* Segments of a digit, 1 means lit whatever DISPLAY_SEGMENT_ACTIVE_LEVEL */
+#define DISPLAY_SEGMENT_A              (uint8)0x01
+#define DISPLAY_SEGMENT_B              (uint8)0x02
+#define DISPLAY_SEGMENT_C              (uint8)0x04
+#define DISPLAY_SEGMENT_D              (uint8)0x08
+#define DISPLAY_SEGMENT_E              (uint8)0x10
+#define DISPLAY_SEGMENT_F              (uint8)0x20
+#define DISPLAY_SEGMENT_G              (uint8)0x40
+#define DISPLAY_SEGMENT_DP             (uint8)0x80
+
+/*
+ * Description: Clear the frame buffer and start the refresh, called once after Dma_Init and Dio_Init.
+ *              The digits are multiplexed by a uDMA task loop paced by Timer4A: at each time-out the uDMA
+ *              turns the digits off, writes the segments of the next digit then selects it, with masked
+ *              stores to the GPIO data registers. The CPU is not used by the refresh whatever its rate.
+ */
+void Display_Init(void);
+
+/* Description: Stop the refresh and turn all the digits off */
+void Display_DeInit(void);
+
+/* Description: Set the lit segments (DISPLAY_SEGMENT_x bits) of a digit, shown from the next refresh of the digit */
+void Display_SetSegments(uint8 Digit, uint8 Segments);
+
+/* Description: Show a hexadecimal value (0x0 --> 0xF) on a digit, the decimal point is kept */
+void Display_SetDigit(uint8 Digit, uint8 Value);
+
+/* Description: Turn off all the segments of all the digits */
+void Display_Clear(void);
+
+#endif /* DISPLAY_H */
@@ -0,0 +1,35 @@
+/******************************************************************************
+ *
+ * Module: Display
+ *
+ * File Name: Display_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Display Module
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef DISPLAY_CFG_H_
+#define DISPLAY_CFG_H_
+
+/* Number of the multiplexed digits (1 --> 8), digit n is bit n of the digit selects group */
+#define DISPLAY_DIGITS                       (4U)
+
+/*
+ * Dio Channel Groups of the display: the segments a..g, dp of all the digits are bits 0..7 of the segments
+ * group, only one digit select of the digits group is active at a time.
+ */
+#define DISPLAY_SEGMENTS_GROUP               DioConf_DISPLAY_SEGMENTS_GROUP_PTR
+#define DISPLAY_DIGITS_GROUP                 DioConf_DISPLAY_DIGITS_GROUP_PTR
+
+/* Refresh rate of the whole display, each digit is lit DISPLAY_REFRESH_RATE_HZ times per second */
+#define DISPLAY_REFRESH_RATE_HZ              (100U)
+
+/* Levels which light a segment and select a digit ... STD_HIGH or STD_LOW (common cathode/anode and drivers) */
+#define DISPLAY_SEGMENT_ACTIVE_LEVEL         (STD_HIGH)
+#define DISPLAY_DIGIT_ACTIVE_LEVEL           (STD_HIGH)
+
+/* uDMA channel requested by the refresh timer (Timer4A with the channel assignment of Dma_Cfg.h) */
+#define DISPLAY_DMA_CHANNEL                  DMA_TIMER4A_CHANNEL
+
+#endif /* DISPLAY_CFG_H_ */
@@ -0,0 +1,386 @@
+ /******************************************************************************
+ *
+ * Module: Dma
+ *
+ * File Name: Dma.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - uDMA Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Dma.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (DMA_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
+
+/* uDMA bit in the RCGCDMA/PRDMA registers */
+#define DMA_CLOCK_BIT                  0x01
+
+/* DMACFG MASTEN bit ... enable the uDMA controller */
+#define DMA_CFG_MASTEN                 0x01
+
+/*
+ * Channel control word of a byte transfer from an incremented source to a fixed destination:
+ * DSTINC = 3 (no increment), DSTSIZE = SRCINC = SRCSIZE = 0 (byte), ARBSIZE = 0 (1 transfer per request)
+ * and XFERMODE = 1 (basic mode, the channel stops after the last transfer)
+ */
+#define DMA_CTL_DSTINC_NONE            (0x3UL << 30)
+#define DMA_CTL_XFERSIZE_POS           4
+#define DMA_CTL_XFERMODE_BASIC         (0x1UL)
+
+/* Channel control word fields of the task loops: byte copies without increment and word copies of the structures */
+#define DMA_CTL_SRCINC_NONE            (0x3UL << 26)
+#define DMA_CTL_WORD_COPY              ((0x2UL << 30) | (0x2UL << 28) | (0x2UL << 26) | (0x2UL << 24))
+#define DMA_CTL_ARBSIZE_4              (0x2UL << 14)
+#define DMA_CTL_XFERMODE_PERIPH_SG     (0x6UL)
+
+/* Number of the words of a task copied by the primary structure, and restored by the reload task */
+#define DMA_TASK_WORDS                 (4U)
+#define DMA_RELOAD_WORDS               (3U)
+
+/* Bit of a channel in the uDMA channel registers (ENASET, ENACLR, REQMASKCLR, ALTCLR ...) */
+#define DMA_CHANNEL_BIT(CHANNEL)       (1UL << (CHANNEL))
+
+/* Entry of the channel control table, the uDMA reads it at each request */
+typedef Dma_TaskType Dma_ControlEntryType;
+
+/*
+ * Channel control table: the primary structures then the alternate structures used by the scatter-gather tasks
+ * ... the DMACTLBASE register requires a 1024 bytes alignment
+ */
+#pragma DATA_ALIGN(Dma_ControlTable, 1024)
+STATIC volatile Dma_ControlEntryType Dma_ControlTable[2U * DMA_NUMBER_OF_CHANNELS];
+
+/* Alternate structure of a channel */
+#define DMA_ALTERNATE_ENTRY(CHANNEL)   (Dma_ControlTable[DMA_NUMBER_OF_CHANNELS + (CHANNEL)])
+
+STATIC uint8 Dma_Status = DMA_NOT_INITIALIZED;
+
+/************************************************************************************
+* Service Name: Dma_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the uDMA controller, set its channel control table
+*              and apply the configured channel assignments.
+************************************************************************************/
+void Dma_Init(void)
+{
+    /* Enable clock for the uDMA and wait for clock to start */
+    SYSCTL_RCGCDMA_REG |= DMA_CLOCK_BIT;
+    while(!(SYSCTL_PRDMA_REG & DMA_CLOCK_BIT));
+
+    UDMA_CFG_REG     = DMA_CFG_MASTEN;
+    UDMA_CTLBASE_REG = (uint32)Dma_ControlTable;
+
+    UDMA_CHMAP0_REG  = DMA_CHANNEL_MAP0;
+    UDMA_CHMAP1_REG  = DMA_CHANNEL_MAP1;
+    UDMA_CHMAP2_REG  = DMA_CHANNEL_MAP2;
+    UDMA_CHMAP3_REG  = DMA_CHANNEL_MAP3;
+
+    Dma_Status = DMA_INITIALIZED;
+}
+
+/************************************************************************************
+* Service Name: Dma_StartTransfer
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - uDMA channel requested by the pacing peripheral
+*                  SourcePtr - Bytes to be transferred
+*                  DestinationPtr - Peripheral register written by each transfer
+*                  Count - Number of bytes (1 --> DMA_MAX_TRANSFER_SIZE)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a basic mode transfer of one byte per peripheral
+*              request, the source is incremented and the destination is fixed.
+*              The channel is disabled by the uDMA after the last transfer.
+************************************************************************************/
+void Dma_StartTransfer(Dma_ChannelType Channel, const uint8 * SourcePtr,
+                       volatile uint32 * DestinationPtr, uint16 Count)
+{
+    boolean error = FALSE;
+
+#if (DMA_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DMA_NOT_INITIALIZED == Dma_Status)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TRANSFER_SID, DMA_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used channel is within the valid range */
+    if (DMA_NUMBER_OF_CHANNELS <= Channel)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TRANSFER_SID, DMA_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the input pointers are not NULL_PTR */
+    if ((NULL_PTR == SourcePtr) || (NULL_PTR == DestinationPtr))
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TRANSFER_SID, DMA_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the number of transfers fits in one basic mode transfer */
+    if ((0U == Count) || (DMA_MAX_TRANSFER_SIZE < Count))
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TRANSFER_SID, DMA_E_PARAM_SIZE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* The uDMA uses the end addresses: the last source byte and the fixed destination */
+        Dma_ControlTable[Channel].SrcEndPtr = (uint32)(SourcePtr + (Count - 1U));
+        Dma_ControlTable[Channel].DstEndPtr = (uint32)DestinationPtr;
+        Dma_ControlTable[Channel].Control   = DMA_CTL_DSTINC_NONE
+                                            | ((uint32)(Count - 1U) << DMA_CTL_XFERSIZE_POS)
+                                            | DMA_CTL_XFERMODE_BASIC;
+
+        /* Use the primary control structure, accept the peripheral requests then enable the channel */
+        UDMA_ALTCLR_REG     = DMA_CHANNEL_BIT(Channel);
+        UDMA_REQMASKCLR_REG = DMA_CHANNEL_BIT(Channel);
+        UDMA_ENASET_REG     = DMA_CHANNEL_BIT(Channel);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Dma_StopTransfer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - uDMA channel to be stopped
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a channel, the remaining transfers are not done.
+************************************************************************************/
+void Dma_StopTransfer(Dma_ChannelType Channel)
+{
+    boolean error = FALSE;
+
+#if (DMA_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the used channel is within the valid range */
+    if (DMA_NUMBER_OF_CHANNELS <= Channel)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_STOP_TRANSFER_SID, DMA_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        UDMA_ENACLR_REG = DMA_CHANNEL_BIT(Channel);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Dma_IsTransferDone
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - uDMA channel to be checked
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel is disabled (transfer done or stopped),
+*                         FALSE for an invalid channel
+* Description: Function to check if the last transfer of a channel is finished.
+************************************************************************************/
+boolean Dma_IsTransferDone(Dma_ChannelType Channel)
+{
+    boolean done = FALSE;
+    boolean error = FALSE;
+
+#if (DMA_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the used channel is within the valid range */
+    if (DMA_NUMBER_OF_CHANNELS <= Channel)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_IS_TRANSFER_DONE_SID, DMA_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* The enable bit is cleared by the uDMA at the end of a basic mode transfer */
+        done = (UDMA_ENASET_REG & DMA_CHANNEL_BIT(Channel)) ? FALSE : TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return done;
+}
+
+/************************************************************************************
+* Service Name: Dma_SetByteTask
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): SourcePtr - Byte copied by the task, read again at each pass of the loop
+*                  DestinationPtr - Peripheral register written by the task
+*                  Mode - DMA_TASK_WAIT_REQUEST or DMA_TASK_IMMEDIATE
+* Parameters (inout): None
+* Parameters (out): TaskPtr - Task to be filled
+* Return value: None
+* Description: Function to fill a task of a task loop copying one byte.
+************************************************************************************/
+void Dma_SetByteTask(Dma_TaskType * TaskPtr, const volatile uint8 * SourcePtr,
+                     volatile uint32 * DestinationPtr, Dma_TaskModeType Mode)
+{
+    /* One transfer, so the end addresses are the addresses themselves */
+    TaskPtr->SrcEndPtr = (uint32)SourcePtr;
+    TaskPtr->DstEndPtr = (uint32)DestinationPtr;
+    TaskPtr->Control   = DMA_CTL_DSTINC_NONE | DMA_CTL_SRCINC_NONE | (uint32)Mode;
+    TaskPtr->Spare     = 0;
+}
+
+/************************************************************************************
+* Service Name: Dma_StartTaskLoop
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - uDMA channel requested by the pacing peripheral
+*                  NumberOfTasks - Number of the tasks (1 --> DMA_MAX_LOOP_TASKS)
+* Parameters (inout): TasksPtr - DMA_TASK_LOOP_ENTRIES(NumberOfTasks) entries, the tasks first,
+*                                the last two entries are filled by this function
+* Parameters (out): None
+* Return value: None
+* Description: Function to run a list of tasks for ever in peripheral scatter-gather mode.
+*              A reload task appended to the list restores the primary control structure,
+*              so the list restarts without the CPU. The array is read by the uDMA and shall
+*              stay valid until Dma_StopTransfer.
+************************************************************************************/
+void Dma_StartTaskLoop(Dma_ChannelType Channel, Dma_TaskType * TasksPtr, uint16 NumberOfTasks)
+{
+    boolean error = FALSE;
+
+#if (DMA_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DMA_NOT_INITIALIZED == Dma_Status)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TASK_LOOP_SID, DMA_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used channel is within the valid range */
+    if (DMA_NUMBER_OF_CHANNELS <= Channel)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TASK_LOOP_SID, DMA_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the input pointer is not a NULL_PTR */
+    if (NULL_PTR == TasksPtr)
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TASK_LOOP_SID, DMA_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the tasks and the reload task fit in one primary transfer */
+    if ((0U == NumberOfTasks) || (DMA_MAX_LOOP_TASKS < NumberOfTasks))
+    {
+        Det_ReportError(DMA_MODULE_ID, DMA_INSTANCE_ID,
+                DMA_START_TASK_LOOP_SID, DMA_E_PARAM_SIZE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Dma_TaskType * reload_task  = &TasksPtr[NumberOfTasks];
+        Dma_TaskType * reload_image = &TasksPtr[NumberOfTasks + 1U];
+
+        /*
+         * Image of the primary structure: copy the 4 words of each task (the reload task included) into the
+         * alternate structure, one task per request of the peripheral.
+         */
+        reload_image->SrcEndPtr = (uint32)&reload_task->Spare;
+        reload_image->DstEndPtr = (uint32)&DMA_ALTERNATE_ENTRY(Channel).Spare;
+        reload_image->Control   = DMA_CTL_WORD_COPY | DMA_CTL_ARBSIZE_4
+                                | ((uint32)((DMA_TASK_WORDS * (NumberOfTasks + 1U)) - 1U) << DMA_CTL_XFERSIZE_POS)
+                                | DMA_CTL_XFERMODE_PERIPH_SG;
+        reload_image->Spare     = 0;
+
+        /* The reload task writes the image back in the primary structure, so the next request restarts the list */
+        reload_task->SrcEndPtr = (uint32)&reload_image->Control;
+        reload_task->DstEndPtr = (uint32)&Dma_ControlTable[Channel].Control;
+        reload_task->Control   = DMA_CTL_WORD_COPY | DMA_CTL_ARBSIZE_4
+                               | ((uint32)(DMA_RELOAD_WORDS - 1U) << DMA_CTL_XFERSIZE_POS)
+                               | DMA_TASK_IMMEDIATE;
+        reload_task->Spare     = 0;
+
+        Dma_ControlTable[Channel].SrcEndPtr = reload_image->SrcEndPtr;
+        Dma_ControlTable[Channel].DstEndPtr = reload_image->DstEndPtr;
+        Dma_ControlTable[Channel].Control   = reload_image->Control;
+
+        /* Use the primary control structure, accept the peripheral requests then enable the channel */
+        UDMA_ALTCLR_REG     = DMA_CHANNEL_BIT(Channel);
+        UDMA_REQMASKCLR_REG = DMA_CHANNEL_BIT(Channel);
+        UDMA_ENASET_REG     = DMA_CHANNEL_BIT(Channel);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
@@ -0,0 +1,212 @@
+ /******************************************************************************
+ *
+ * Module: Dma
+ *
+ * File Name: Dma.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - uDMA Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef DMA_H
+#define DMA_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define DMA_VENDOR_ID    (1000U)
+
+/* Dma Module Id ... Non AUTOSAR module, Id taken from the vendor specific range */
+#define DMA_MODULE_ID    (251U)
+
+/* Dma Instance Id */
+#define DMA_INSTANCE_ID  (0U)
+
+/*
+ * Macros for Dma Status
+ */
+#define DMA_INITIALIZED                (1U)
+#define DMA_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* Dma Pre-Compile Configuration Header file */
+#include "Dma_Cfg.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Dma Init */
+#define DMA_INIT_SID                   (uint8)0x00
+
+/* Service ID for Dma Start Transfer */
+#define DMA_START_TRANSFER_SID         (uint8)0x01
+
+/* Service ID for Dma Stop Transfer */
+#define DMA_STOP_TRANSFER_SID          (uint8)0x02
+
+/* Service ID for Dma Start Task Loop */
+#define DMA_START_TASK_LOOP_SID        (uint8)0x03
+
+/* Service ID for Dma Is Transfer Done */
+#define DMA_IS_TRANSFER_DONE_SID       (uint8)0x04
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report Invalid Channel */
+#define DMA_E_PARAM_CHANNEL            (uint8)0x11
+
+/* DET code to report Invalid number of transfers */
+#define DMA_E_PARAM_SIZE               (uint8)0x12
+
+/* DET code to report NULL pointer */
+#define DMA_E_PARAM_POINTER            (uint8)0x20
+
+/* API service used without module initialization */
+#define DMA_E_UNINIT                   (uint8)0xF0
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of the TM4C123GH6PM uDMA channels */
+#define DMA_NUMBER_OF_CHANNELS         (32U)
+
+/* Maximum number of transfers of one basic mode transfer (XFERSIZE is 10 bits) */
+#define DMA_MAX_TRANSFER_SIZE          (1024U)
+
+/* Channels of the timer requests with the channel assignment encoding 0 */
+#define DMA_TIMER0A_CHANNEL            (Dma_ChannelType)18
+#define DMA_TIMER0B_CHANNEL            (Dma_ChannelType)19
+#define DMA_TIMER1A_CHANNEL            (Dma_ChannelType)20
+#define DMA_TIMER1B_CHANNEL            (Dma_ChannelType)21
+
+/* Channel of the Timer4A requests with the channel assignment encoding 3 */
+#define DMA_TIMER4A_CHANNEL            (Dma_ChannelType)0
+
+/* Maximum number of tasks of a task loop (the primary structure copies 4 words per task, the reload is a task) */
+#define DMA_MAX_LOOP_TASKS             ((DMA_MAX_TRANSFER_SIZE / 4U) - 1U)
+
+/* Number of the entries of a task loop array of NUMBER tasks: the tasks, the reload task and the reload image */
+#define DMA_TASK_LOOP_ENTRIES(NUMBER)  ((NUMBER) + 2U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the uDMA channel number used by the Dma APIs */
+typedef uint8 Dma_ChannelType;
+
+/* Type definition for the start condition of a task of a task loop */
+typedef uint8 Dma_TaskModeType;
+
+/* The task waits for a request of the peripheral of the channel */
+#define DMA_TASK_WAIT_REQUEST          (Dma_TaskModeType)0x07
+
+/* The task is done right after the previous one, without waiting for a request */
+#define DMA_TASK_IMMEDIATE             (Dma_TaskModeType)0x05
+
+/* One task of a task loop, the same layout as the channel control structure which the uDMA copies it into */
+typedef struct
+{
+    uint32 SrcEndPtr;
+    uint32 DstEndPtr;
+    uint32 Control;
+    uint32 Spare;
+} Dma_TaskType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Dma_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the uDMA controller, set its channel control table
+*              and apply the configured channel assignments.
+************************************************************************************/
+void Dma_Init(void);
+
+/************************************************************************************
+* Service Name: Dma_StartTransfer
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - uDMA channel requested by the pacing peripheral
+*                  SourcePtr - Bytes to be transferred
+*                  DestinationPtr - Peripheral register written by each transfer
+*                  Count - Number of bytes (1 --> DMA_MAX_TRANSFER_SIZE)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start a basic mode transfer of one byte per peripheral
+*              request, the source is incremented and the destination is fixed.
+*              The channel is disabled by the uDMA after the last transfer.
+************************************************************************************/
+void Dma_StartTransfer(Dma_ChannelType Channel, const uint8 * SourcePtr,
+                       volatile uint32 * DestinationPtr, uint16 Count);
+
+/************************************************************************************
+* Service Name: Dma_StopTransfer
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - uDMA channel to be stopped
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable a channel, the remaining transfers are not done.
+************************************************************************************/
+void Dma_StopTransfer(Dma_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Dma_IsTransferDone
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Channel - uDMA channel to be checked
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: boolean - TRUE if the channel is disabled (transfer done or stopped),
+*                         FALSE for an invalid channel
+* Description: Function to check if the last transfer of a channel is finished.
+************************************************************************************/
+boolean Dma_IsTransferDone(Dma_ChannelType Channel);
+
+/************************************************************************************
+* Service Name: Dma_SetByteTask
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): SourcePtr - Byte copied by the task, read again at each pass of the loop
+*                  DestinationPtr - Peripheral register written by the task
+*                  Mode - DMA_TASK_WAIT_REQUEST or DMA_TASK_IMMEDIATE
+* Parameters (inout): None
+* Parameters (out): TaskPtr - Task to be filled
+* Return value: None
+* Description: Function to fill a task of a task loop copying one byte.
+************************************************************************************/
+void Dma_SetByteTask(Dma_TaskType * TaskPtr, const volatile uint8 * SourcePtr,
+                     volatile uint32 * DestinationPtr, Dma_TaskModeType Mode);
+
+/************************************************************************************
+* Service Name: Dma_StartTaskLoop
+* Sync/Async: Asynchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): Channel - uDMA channel requested by the pacing peripheral
+*                  NumberOfTasks - Number of the tasks (1 --> DMA_MAX_LOOP_TASKS)
+* Parameters (inout): TasksPtr - DMA_TASK_LOOP_ENTRIES(NumberOfTasks) entries, the tasks first,
+*                                the last two entries are filled by this function
+* Parameters (out): None
+* Return value: None
+* Description: Function to run a list of tasks for ever in peripheral scatter-gather mode.
+*              A reload task appended to the list restores the primary control structure,
+*              so the list restarts without the CPU. The array is read by the uDMA and shall
+*              stay valid until Dma_StopTransfer.
+************************************************************************************/
+void Dma_StartTaskLoop(Dma_ChannelType Channel, Dma_TaskType * TasksPtr, uint16 NumberOfTasks);
+
+#endif /* DMA_H */
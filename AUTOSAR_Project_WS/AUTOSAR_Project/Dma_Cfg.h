@@ -0,0 +1,28 @@
+ /******************************************************************************
+ *
+ * Module: Dma
+ *
+ * File Name: Dma_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - uDMA Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef DMA_CFG_H
+#define DMA_CFG_H
+
+/* Pre-compile option for Development Error Detect */
+#define DMA_DEV_ERROR_DETECT                (STD_ON)
+
+/*
+ * Channel assignment encodings written in DMACHMAP0..3 at Dma_Init (4 bits per channel, channel 0 in
+ * DMACHMAP0 bits 3:0). The reset encoding 0 assigns the Timer0A/B and Timer1A/B requests to channels 18..21,
+ * the encoding 3 of channel 0 assigns it the Timer4A requests (Display refresh).
+ */
+#define DMA_CHANNEL_MAP0                    (0x00000003U)
+#define DMA_CHANNEL_MAP1                    (0x00000000U)
+#define DMA_CHANNEL_MAP2                    (0x00000000U)
+#define DMA_CHANNEL_MAP3                    (0x00000000U)
+
+#endif /* DMA_CFG_H */
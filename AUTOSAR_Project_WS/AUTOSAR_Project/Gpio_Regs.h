@@ -0,0 +1,43 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Gpio_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - GPIO Registers base addresses in the
+ *              APB/AHB aperture selected by the Mcu Driver, shared by the Port and Dio Drivers
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef GPIO_REGS_H
+#define GPIO_REGS_H
+
+/* Mcu Pre-Compile Configuration Header file ... GPIO aperture selection */
+#include "Mcu_Cfg.h"
+
+/* GPIO Registers base addresses in the legacy APB aperture */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
+
+/* GPIO Registers base addresses in the AHB aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
+/* GPIO Registers base addresses in the aperture selected for each port by MCU_GPIO_AHB_PORTS */
+#define GPIO_PORTA_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x01U) ? GPIO_PORTA_AHB_BASE_ADDRESS : GPIO_PORTA_APB_BASE_ADDRESS)
+#define GPIO_PORTB_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x02U) ? GPIO_PORTB_AHB_BASE_ADDRESS : GPIO_PORTB_APB_BASE_ADDRESS)
+#define GPIO_PORTC_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x04U) ? GPIO_PORTC_AHB_BASE_ADDRESS : GPIO_PORTC_APB_BASE_ADDRESS)
+#define GPIO_PORTD_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x08U) ? GPIO_PORTD_AHB_BASE_ADDRESS : GPIO_PORTD_APB_BASE_ADDRESS)
+#define GPIO_PORTE_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x10U) ? GPIO_PORTE_AHB_BASE_ADDRESS : GPIO_PORTE_APB_BASE_ADDRESS)
+#define GPIO_PORTF_BASE_ADDRESS           ((MCU_GPIO_AHB_PORTS & 0x20U) ? GPIO_PORTF_AHB_BASE_ADDRESS : GPIO_PORTF_APB_BASE_ADDRESS)
+
+#endif /* GPIO_REGS_H */
@@ -10,28 +10,81 @@
  ******************************************************************************/
 
 #include "Gpt.h"
+#include "Irq.h"
 #include "tm4c123gh6pm_registers.h"
 
-#define SYSTICK_PRIORITY_MASK  0x1FFFFFFF
-#define SYSTICK_INTERRUPT_PRIORITY  3
-#define SYSTICK_PRIORITY_BITS_POS   29
+/* Timer0 bit in the RCGCTIMER/PRTIMER registers */
+#define GPT_TIMER0_CLOCK_BIT           0x01
 
-/* Global pointer to function used to point upper layer functions
- * to be used in Call Back */
-static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
+/* Timer1 bit in the RCGCTIMER/PRTIMER registers */
+#define GPT_TIMER1_CLOCK_BIT           0x02
+
+/* Timer2 bit in the RCGCTIMER/PRTIMER registers */
+#define GPT_TIMER2_CLOCK_BIT           0x04
+
+/* Timer3 bit in the RCGCTIMER/PRTIMER registers */
+#define GPT_TIMER3_CLOCK_BIT           0x08
+
+/* Timer4 bit in the RCGCTIMER/PRTIMER registers */
+#define GPT_TIMER4_CLOCK_BIT           0x10
+
+/* GPTMCTL TAEN bit ... enable the Timer A */
+#define GPT_TIMER_CTL_TAEN             0x01
+
+/* GPTMTAMR value: periodic mode (TAMR = 0x2) counting up (TACDIR = 1) */
+#define GPT_TIMER_TAMR_PERIODIC_UP     0x12
+
+/* GPTMTAMR value: periodic mode (TAMR = 0x2) counting down */
+#define GPT_TIMER_TAMR_PERIODIC_DOWN   0x02
+
+/* GPTMTAMR value: one-shot mode (TAMR = 0x1) counting down */
+#define GPT_TIMER_TAMR_ONE_SHOT_DOWN   0x01
+
+/* Timer A time-out bit in the GPTMIMR/GPTMICR registers */
+#define GPT_TIMER_TATO_BIT             0x01
+
+/* Upper layer function called at the time-out of the one-shot timer */
+STATIC void (*Gpt_OneShotNotification)(void) = NULL_PTR;
+
+/* Upper layer function called at each time-out of the periodic timer */
+STATIC void (*Gpt_PeriodicNotification)(void) = NULL_PTR;
+
+/* Timer2A time-out ISR installed in the RAM vector table by Gpt_InitOneShot */
+STATIC void Gpt_OneShot_Handler(void)
+{
+    TIMER2_ICR_REG = GPT_TIMER_TATO_BIT;             /* Clear the time-out flag */
+    if(NULL_PTR != Gpt_OneShotNotification)
+    {
+        Gpt_OneShotNotification();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Timer3A time-out ISR installed in the RAM vector table by Gpt_StartPeriodic */
+STATIC void Gpt_Periodic_Handler(void)
+{
+    TIMER3_ICR_REG = GPT_TIMER_TATO_BIT;             /* Clear the time-out flag */
+    if(NULL_PTR != Gpt_PeriodicNotification)
+    {
+        Gpt_PeriodicNotification();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
 
 /************************************************************************************
 * Service Name: SysTick_Handler
-* Description: SysTick Timer ISR
+* Description: Default SysTick Timer ISR in the Flash vector table, it is replaced in the
+*              RAM vector table by the upper layer function installed by SysTick_SetCallBack
 ************************************************************************************/
 void SysTick_Handler(void)
 {
-    /* Check if the SysTick_SetCallBack is already called */
-    if(g_SysTick_Call_Back_Ptr != NULL_PTR)
-    {
-        (*g_SysTick_Call_Back_Ptr)(); /* call the function in the scheduler using call-back concept */
-    }
-    /* No need to clear the trigger flag (COUNT) bit ... it cleared automatically by the HW */
+    /* No Action Required ... No need to clear the trigger flag (COUNT) bit, it cleared automatically by the HW */
 }
 
 /************************************************************************************
@@ -45,7 +98,7 @@ void SysTick_Handler(void)
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
 *              - Enable SysTick Timer with System clock 16Mhz
-*              - Enable SysTick Timer Interrupt and set its priority
+*              - Enable SysTick Timer Interrupt, its priority is configured by the Irq Driver
 ************************************************************************************/
 void SysTick_Start(uint16 Tick_Time)
 {
@@ -57,8 +110,6 @@ void SysTick_Start(uint16 Tick_Time)
      * Enable SysTick Interrupt (INTEN = 1)
      * Choose the clock source to be System Clock (CLK_SRC = 1) */
     SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
 }
 
 /************************************************************************************
@@ -84,9 +135,227 @@ void SysTick_Stop(void)
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, the function is installed
+*              directly in the RAM vector table so it is called as the SysTick ISR itself
 ************************************************************************************/
 void SysTick_SetCallBack(void(*Ptr2Func)(void))
 {
-    g_SysTick_Call_Back_Ptr = Ptr2Func;
+    Irq_Register(IRQ_SYSTICK_VECTOR,Ptr2Func);
+}
+
+/************************************************************************************
+* Service Name: Gpt_StartTimeBase
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer0 as a free running 32-bit up counter clocked by
+*              the system clock, used as the time stamp base (wraps every 2^32 counts).
+************************************************************************************/
+void Gpt_StartTimeBase(void)
+{
+    /* Enable clock for Timer0 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= GPT_TIMER0_CLOCK_BIT;
+    while(!(SYSCTL_PRTIMER_REG & GPT_TIMER0_CLOCK_BIT));
+
+    TIMER0_CTL_REG   = 0;                            /* Disable Timer A before the configuration */
+    TIMER0_CFG_REG   = 0;                            /* 32-bit timer configuration */
+    TIMER0_TAMR_REG  = GPT_TIMER_TAMR_PERIODIC_UP;   /* Periodic mode counting up */
+    TIMER0_TAILR_REG = 0xFFFFFFFF;                   /* Count the full 32-bit range */
+    TIMER0_IMR_REG   = 0;                            /* No interrupts, the counter is only read */
+    TIMER0_CTL_REG   = GPT_TIMER_CTL_TAEN;           /* Start counting */
+}
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeStamp
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current time stamp in system clock counts
+* Description: Function to return the time stamp base counter, the elapsed time between
+*              two time stamps is their unsigned difference (valid across one wrap).
+************************************************************************************/
+uint32 Gpt_GetTimeStamp(void)
+{
+    return TIMER0_TAV_REG;
+}
+
+/************************************************************************************
+* Service Name: Gpt_StartDmaTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two uDMA requests in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer1A as a periodic timer, each time-out requests one
+*              transfer of the uDMA channel DMA_TIMER1A_CHANNEL. The timer interrupt is
+*              not enabled in the NVIC so the CPU is not involved.
+************************************************************************************/
+void Gpt_StartDmaTrigger(uint32 Period)
+{
+    /* Enable clock for Timer1 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= GPT_TIMER1_CLOCK_BIT;
+    while(!(SYSCTL_PRTIMER_REG & GPT_TIMER1_CLOCK_BIT));
+
+    TIMER1_CTL_REG   = 0;                            /* Disable Timer A before the configuration */
+    TIMER1_CFG_REG   = 0;                            /* 32-bit timer configuration */
+    TIMER1_TAMR_REG  = GPT_TIMER_TAMR_PERIODIC_DOWN; /* Periodic mode counting down */
+    TIMER1_TAILR_REG = Period - 1U;                  /* Time-out every Period counts */
+    TIMER1_ICR_REG   = GPT_TIMER_TATO_BIT;           /* Clear any old time-out */
+    TIMER1_IMR_REG   = GPT_TIMER_TATO_BIT;           /* The time-out is the uDMA request, the NVIC line stays disabled */
+    TIMER1_CTL_REG   = GPT_TIMER_CTL_TAEN;           /* Start counting */
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopDmaTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer1A, no more uDMA requests are generated.
+************************************************************************************/
+void Gpt_StopDmaTrigger(void)
+{
+    TIMER1_CTL_REG = 0;                              /* Disable Timer A */
+    TIMER1_IMR_REG = 0;
+}
+
+/************************************************************************************
+* Service Name: Gpt_InitOneShot
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Notification - Function called from the Timer2A time-out ISR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure Timer2A as a one-shot timer and install its ISR,
+*              its priority is configured by the Irq Driver.
+************************************************************************************/
+void Gpt_InitOneShot(void (*Notification)(void))
+{
+    /* Enable clock for Timer2 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= GPT_TIMER2_CLOCK_BIT;
+    while(!(SYSCTL_PRTIMER_REG & GPT_TIMER2_CLOCK_BIT));
+
+    TIMER2_CTL_REG   = 0;                            /* Disable Timer A before the configuration */
+    TIMER2_CFG_REG   = 0;                            /* 32-bit timer configuration */
+    TIMER2_TAMR_REG  = GPT_TIMER_TAMR_ONE_SHOT_DOWN; /* One-shot mode counting down */
+    TIMER2_ICR_REG   = GPT_TIMER_TATO_BIT;           /* Clear any old time-out */
+
+    Gpt_OneShotNotification = Notification;
+    Irq_Register(IRQ_TIMER2A_VECTOR,Gpt_OneShot_Handler);
+    TIMER2_IMR_REG   = GPT_TIMER_TATO_BIT;           /* Enable the time-out interrupt */
+}
+
+/************************************************************************************
+* Service Name: Gpt_StartOneShot
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time until the notification in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to (re)start the one-shot timer, a running count is restarted.
+************************************************************************************/
+void Gpt_StartOneShot(uint32 Period)
+{
+    TIMER2_CTL_REG   = 0;                            /* Stop a running count */
+    TIMER2_TAILR_REG = Period - 1U;                  /* Loaded when the timer is enabled */
+    TIMER2_CTL_REG   = GPT_TIMER_CTL_TAEN;           /* Start counting, the timer stops itself at the time-out */
+}
+
+/************************************************************************************
+* Service Name: Gpt_StartPeriodic
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two notifications in system clock counts
+*                  Notification - Function called from the Timer3A time-out ISR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer3A as a periodic timer and install its ISR,
+*              its priority is configured by the Irq Driver.
+************************************************************************************/
+void Gpt_StartPeriodic(uint32 Period, void (*Notification)(void))
+{
+    /* Enable clock for Timer3 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= GPT_TIMER3_CLOCK_BIT;
+    while(!(SYSCTL_PRTIMER_REG & GPT_TIMER3_CLOCK_BIT));
+
+    TIMER3_CTL_REG   = 0;                            /* Disable Timer A before the configuration */
+    TIMER3_CFG_REG   = 0;                            /* 32-bit timer configuration */
+    TIMER3_TAMR_REG  = GPT_TIMER_TAMR_PERIODIC_DOWN; /* Periodic mode counting down */
+    TIMER3_TAILR_REG = Period - 1U;                  /* One time-out every Period counts */
+    TIMER3_ICR_REG   = GPT_TIMER_TATO_BIT;           /* Clear any old time-out */
+
+    Gpt_PeriodicNotification = Notification;
+    Irq_Register(IRQ_TIMER3A_VECTOR,Gpt_Periodic_Handler);
+    TIMER3_IMR_REG   = GPT_TIMER_TATO_BIT;           /* Enable the time-out interrupt */
+    TIMER3_CTL_REG   = GPT_TIMER_CTL_TAEN;           /* Start counting */
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopPeriodic
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer3A, no more notifications are called.
+************************************************************************************/
+void Gpt_StopPeriodic(void)
+{
+    TIMER3_CTL_REG = 0;                              /* Disable Timer A */
+    TIMER3_IMR_REG = 0;
+}
+
+/************************************************************************************
+* Service Name: Gpt_StartRefreshTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two uDMA requests in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer4A as a periodic timer, each time-out requests the
+*              uDMA channel DMA_TIMER4A_CHANNEL. Same as Gpt_StartDmaTrigger for a second
+*              uDMA user, the timer interrupt is not enabled in the NVIC.
+************************************************************************************/
+void Gpt_StartRefreshTrigger(uint32 Period)
+{
+    /* Enable clock for Timer4 and wait for clock to start */
+    SYSCTL_RCGCTIMER_REG |= GPT_TIMER4_CLOCK_BIT;
+    while(!(SYSCTL_PRTIMER_REG & GPT_TIMER4_CLOCK_BIT));
+
+    TIMER4_CTL_REG   = 0;                            /* Disable Timer A before the configuration */
+    TIMER4_CFG_REG   = 0;                            /* 32-bit timer configuration */
+    TIMER4_TAMR_REG  = GPT_TIMER_TAMR_PERIODIC_DOWN; /* Periodic mode counting down */
+    TIMER4_TAILR_REG = Period - 1U;                  /* Time-out every Period counts */
+    TIMER4_ICR_REG   = GPT_TIMER_TATO_BIT;           /* Clear any old time-out */
+    TIMER4_IMR_REG   = GPT_TIMER_TATO_BIT;           /* The time-out is the uDMA request, the NVIC line stays disabled */
+    TIMER4_CTL_REG   = GPT_TIMER_CTL_TAEN;           /* Start counting */
+}
+
+/************************************************************************************
+* Service Name: Gpt_StopRefreshTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer4A, no more uDMA requests are generated.
+************************************************************************************/
+void Gpt_StopRefreshTrigger(void)
+{
+    TIMER4_CTL_REG = 0;                              /* Disable Timer A */
+    TIMER4_IMR_REG = 0;
 }
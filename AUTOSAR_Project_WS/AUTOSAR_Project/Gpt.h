@@ -13,6 +13,10 @@
 #define GPT_H
 
 #include "Std_Types.h"
+#include "Mcu_Cfg.h"
+
+/* Number of the time stamp counts in one micro-second ... the time stamp counts the system clock */
+#define GPT_TIMESTAMP_TICKS_PER_US     (MCU_RUN_CLOCK_FREQ_HZ / 1000000U)
 
 /*******************************************************************************
  *                      Function Prototypes                                    *
@@ -29,7 +33,7 @@
 * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
 *              - Set the Reload value
 *              - Enable SysTick Timer with System clock 16Mhz
-*              - Enable SysTick Timer Interrupt and set its priority
+*              - Enable SysTick Timer Interrupt, its priority is configured by the Irq Driver
 ************************************************************************************/	
 void SysTick_Start(uint16 Tick_Time);
 
@@ -53,8 +57,138 @@ void SysTick_Stop(void);
 * Parameters (inout): None
 * Parameters (out): None
 * Return value: None
-* Description: Function to Setup the SysTick Timer call back
+* Description: Function to Setup the SysTick Timer call back, the function is installed
+*              directly in the RAM vector table so it is called as the SysTick ISR itself
 ************************************************************************************/
 void SysTick_SetCallBack(void (*Ptr2Func)(void));
 
+/************************************************************************************
+* Service Name: Gpt_StartTimeBase
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer0 as a free running 32-bit up counter clocked by
+*              the system clock, used as the time stamp base (wraps every 2^32 counts).
+************************************************************************************/
+void Gpt_StartTimeBase(void);
+
+/************************************************************************************
+* Service Name: Gpt_GetTimeStamp
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint32 - Current time stamp in system clock counts
+* Description: Function to return the time stamp base counter, the elapsed time between
+*              two time stamps is their unsigned difference (valid across one wrap).
+************************************************************************************/
+uint32 Gpt_GetTimeStamp(void);
+
+/************************************************************************************
+* Service Name: Gpt_StartDmaTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two uDMA requests in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer1A as a periodic timer, each time-out requests one
+*              transfer of the uDMA channel DMA_TIMER1A_CHANNEL. The timer interrupt is
+*              not enabled in the NVIC so the CPU is not involved.
+************************************************************************************/
+void Gpt_StartDmaTrigger(uint32 Period);
+
+/************************************************************************************
+* Service Name: Gpt_StopDmaTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer1A, no more uDMA requests are generated.
+************************************************************************************/
+void Gpt_StopDmaTrigger(void);
+
+/************************************************************************************
+* Service Name: Gpt_InitOneShot
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Notification - Function called from the Timer2A time-out ISR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to configure Timer2A as a one-shot timer and install its ISR,
+*              its priority is configured by the Irq Driver.
+************************************************************************************/
+void Gpt_InitOneShot(void (*Notification)(void));
+
+/************************************************************************************
+* Service Name: Gpt_StartOneShot
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time until the notification in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to (re)start the one-shot timer, a running count is restarted.
+************************************************************************************/
+void Gpt_StartOneShot(uint32 Period);
+
+/************************************************************************************
+* Service Name: Gpt_StartPeriodic
+* Sync/Async: Asynchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two notifications in system clock counts
+*                  Notification - Function called from the Timer3A time-out ISR
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer3A as a periodic timer and install its ISR,
+*              its priority is configured by the Irq Driver.
+************************************************************************************/
+void Gpt_StartPeriodic(uint32 Period, void (*Notification)(void));
+
+/************************************************************************************
+* Service Name: Gpt_StopPeriodic
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer3A, no more notifications are called.
+************************************************************************************/
+void Gpt_StopPeriodic(void);
+
+/************************************************************************************
+* Service Name: Gpt_StartRefreshTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): Period - Time between two uDMA requests in system clock counts
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to start Timer4A as a periodic timer, each time-out requests the
+*              uDMA channel DMA_TIMER4A_CHANNEL. Same as Gpt_StartDmaTrigger for a second
+*              uDMA user, the timer interrupt is not enabled in the NVIC.
+************************************************************************************/
+void Gpt_StartRefreshTrigger(uint32 Period);
+
+/************************************************************************************
+* Service Name: Gpt_StopRefreshTrigger
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to stop Timer4A, no more uDMA requests are generated.
+************************************************************************************/
+void Gpt_StopRefreshTrigger(void);
+
 #endif /* GPT_H */
@@ -0,0 +1,252 @@
+/******************************************************************************
+ *
+ * Module: Hsm
+ *
+ * File Name: Hsm.c
+ *
+ * Description: Source file for Hsm Module, a table driven hierarchical state machine engine.
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Hsm.h"
+
+#if (HSM_MAX_DEPTH < 1U) || (HSM_MAX_DEPTH > 16U)
+  #error "HSM_MAX_DEPTH shall be 1 --> 16"
+#endif
+
+/* Function to find the first transition of a state on an event, after the transition Start of the table */
+static uint8 Hsm_FindTransition(const Hsm_ConfigType * Config, Hsm_StateIdType State, Hsm_EventIdType Event, uint8 Start)
+{
+    uint8 found = HSM_NO_TRANSITION;
+    uint8 index;
+
+    for(index = Start; (index < Config->NumberOfTransitions) && (HSM_NO_TRANSITION == found); index++)
+    {
+        if((State == Config->Transitions[index].Source) && (Event == Config->Transitions[index].Event))
+        {
+            found = index;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return found;
+}
+
+/*
+ * Function to find the first transition on an event of a state or of its parents, starting with the
+ * transitions of the state after the transition Start
+ */
+static uint8 Hsm_FindInherited(const Hsm_ConfigType * Config, Hsm_StateIdType State, Hsm_EventIdType Event, uint8 Start)
+{
+    uint8 found = Hsm_FindTransition(Config,State,Event,Start);
+    Hsm_StateIdType parent = Config->States[State].Parent;
+
+    while((HSM_NO_TRANSITION == found) && (HSM_NO_STATE != parent))
+    {
+        found  = Hsm_FindTransition(Config,parent,Event,0U);
+        parent = Config->States[parent].Parent;
+    }
+    return found;
+}
+
+/* Function to check if a state is a state or one of its parents */
+static boolean Hsm_IsAncestor(const Hsm_ConfigType * Config, Hsm_StateIdType Ancestor, Hsm_StateIdType State)
+{
+    while((HSM_NO_STATE != State) && (Ancestor != State))
+    {
+        State = Config->States[State].Parent;
+    }
+    return (Ancestor == State) ? TRUE : FALSE;
+}
+
+/* Function to call an entry or exit action if the state has one */
+static void Hsm_CallAction(Hsm_ActionType Action, const Hsm_EventType * EventPtr)
+{
+    if(NULL_PTR != Action)
+    {
+        Action(EventPtr);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*
+ * Function to enter a target state from one of its parents (HSM_NO_STATE for outside all the states):
+ * entry actions from below the parent down to the target, then down the initial children of the target
+ */
+static void Hsm_Enter(Hsm_MachineType * MachinePtr, Hsm_StateIdType From, Hsm_StateIdType Target,
+                      const Hsm_EventType * EventPtr)
+{
+    const Hsm_ConfigType * config = MachinePtr->Config;
+    Hsm_StateIdType path[HSM_MAX_DEPTH];
+    Hsm_StateIdType state;
+    uint8 depth = 0;
+
+    /* The entry actions are called top down, so the path is collected bottom up first */
+    for(state = Target; (state != From) && (depth < HSM_MAX_DEPTH); state = config->States[state].Parent)
+    {
+        path[depth] = state;
+        depth++;
+    }
+    while(depth > 0U)
+    {
+        depth--;
+        Hsm_CallAction(config->States[path[depth]].Entry,EventPtr);
+    }
+
+    state = Target;
+    while(HSM_NO_STATE != config->States[state].InitialChild)
+    {
+        state = config->States[state].InitialChild;
+        Hsm_CallAction(config->States[state].Entry,EventPtr);
+    }
+    MachinePtr->Current = state;
+}
+
+/* Function to take a transition from the current state */
+static void Hsm_Transition(Hsm_MachineType * MachinePtr, const Hsm_TransitionType * Transition,
+                           const Hsm_EventType * EventPtr)
+{
+    const Hsm_ConfigType * config = MachinePtr->Config;
+    Hsm_StateIdType common;
+    Hsm_StateIdType state;
+
+    if(HSM_NO_STATE == Transition->Target)
+    {
+        /* Internal transition: the current state is kept, no exit and no entry actions */
+        Hsm_CallAction(Transition->Action,EventPtr);
+    }
+    else
+    {
+        /*
+         * Lowest common parent of the source and the target: the source is exited and entered again when it
+         * is the target or contains it (an external transition)
+         */
+        common = config->States[Transition->Source].Parent;
+        while((HSM_NO_STATE != common) && (FALSE == Hsm_IsAncestor(config,common,Transition->Target)))
+        {
+            common = config->States[common].Parent;
+        }
+
+        /* Exit actions from the current leaf state up to the common parent */
+        for(state = MachinePtr->Current; state != common; state = config->States[state].Parent)
+        {
+            Hsm_CallAction(config->States[state].Exit,EventPtr);
+        }
+
+        Hsm_CallAction(Transition->Action,EventPtr);
+        Hsm_Enter(MachinePtr,common,Transition->Target,EventPtr);
+    }
+}
+
+/*******************************************************************************************************************/
+void Hsm_Init(Hsm_MachineType * MachinePtr)
+{
+    const Hsm_ConfigType * config = MachinePtr->Config;
+    const Hsm_EventType init_event = { 0U, 0U };
+    Hsm_StateIdType state;
+    Hsm_EventIdType event;
+    uint8 index;
+
+    /* The lookup of a state inherits the transitions of its parents, so the dispatch never walks the parents */
+    for(state = 0; state < config->NumberOfStates; state++)
+    {
+        for(event = 0; event < config->NumberOfEvents; event++)
+        {
+            MachinePtr->Lookup[(state * config->NumberOfEvents) + event] = Hsm_FindInherited(config,state,event,0U);
+        }
+    }
+
+    /* The candidate after a transition: the next one of its source on the same event, else one of the parents */
+    for(index = 0; index < config->NumberOfTransitions; index++)
+    {
+        MachinePtr->NextCandidate[index] = Hsm_FindInherited(config,config->Transitions[index].Source,
+                                                             config->Transitions[index].Event,(uint8)(index + 1U));
+    }
+
+    MachinePtr->QueueHead = 0;
+    MachinePtr->QueueTail = 0;
+    MachinePtr->QueueOverflowCount = 0;
+
+    /* Enter the initial state from outside all the states, the entry actions get an event of id 0 */
+    Hsm_Enter(MachinePtr,HSM_NO_STATE,config->InitialState,&init_event);
+}
+
+/*******************************************************************************************************************/
+boolean Hsm_Dispatch(Hsm_MachineType * MachinePtr, const Hsm_EventType * EventPtr)
+{
+    const Hsm_ConfigType * config = MachinePtr->Config;
+    uint8 candidate = HSM_NO_TRANSITION;
+    boolean handled = FALSE;
+
+    if(EventPtr->Id < config->NumberOfEvents)
+    {
+        candidate = MachinePtr->Lookup[(MachinePtr->Current * config->NumberOfEvents) + EventPtr->Id];
+    }
+    else
+    {
+        /* No Action Required ... an unknown event is not handled */
+    }
+
+    /* The candidates are tried in their order until a guard is TRUE */
+    while((HSM_NO_TRANSITION != candidate) && (FALSE == handled))
+    {
+        const Hsm_TransitionType * transition = &config->Transitions[candidate];
+
+        if((NULL_PTR == transition->Guard) || (TRUE == transition->Guard(EventPtr)))
+        {
+            Hsm_Transition(MachinePtr,transition,EventPtr);
+            handled = TRUE;
+        }
+        else
+        {
+            candidate = MachinePtr->NextCandidate[candidate];
+        }
+    }
+    return handled;
+}
+
+/*******************************************************************************************************************/
+boolean Hsm_PostEvent(Hsm_MachineType * MachinePtr, Hsm_EventIdType EventId, uint8 Data)
+{
+    uint8 next = (uint8)((MachinePtr->QueueHead + 1U) & (MachinePtr->QueueSize - 1U));
+    boolean queued = FALSE;
+
+    if(next != MachinePtr->QueueTail)
+    {
+        MachinePtr->Queue[MachinePtr->QueueHead].Id   = EventId;
+        MachinePtr->Queue[MachinePtr->QueueHead].Data = Data;
+        /* The head is moved after the entry is written, so the consumer never reads a partial entry */
+        MachinePtr->QueueHead = next;
+        queued = TRUE;
+    }
+    else
+    {
+        MachinePtr->QueueOverflowCount++;
+    }
+    return queued;
+}
+
+/*******************************************************************************************************************/
+void Hsm_MainFunction(Hsm_MachineType * MachinePtr)
+{
+    Hsm_EventType event;
+
+    while(MachinePtr->QueueTail != MachinePtr->QueueHead)
+    {
+        event = MachinePtr->Queue[MachinePtr->QueueTail];
+        MachinePtr->QueueTail = (uint8)((MachinePtr->QueueTail + 1U) & (MachinePtr->QueueSize - 1U));
+        (void)Hsm_Dispatch(MachinePtr,&event);
+    }
+}
+
+/*******************************************************************************************************************/
+boolean Hsm_IsInState(const Hsm_MachineType * MachinePtr, Hsm_StateIdType State)
+{
+    return Hsm_IsAncestor(MachinePtr->Config,State,MachinePtr->Current);
+}
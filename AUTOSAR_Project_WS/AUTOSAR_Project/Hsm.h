@@ -0,0 +1,132 @@
+/******************************************************************************
+ *
+ * Module: Hsm
+ *
+ * File Name: Hsm.h
+ *
+ * Description: Header file for Hsm Module, a table driven hierarchical state machine engine.
+ *
+ * Author: agent
+ ******************************************************************************/
+#ifndef HSM_H
+#define HSM_H
+
+#include "Std_Types.h"
+#include "Hsm_Cfg.h"
+
+/* Type definitions for the state and event identifiers, the indexes in the state table and the event range */
+typedef uint8 Hsm_StateIdType;
+typedef uint8 Hsm_EventIdType;
+
+/* Parent of a top level state, initial child of a leaf state, or target of an internal transition */
+#define HSM_NO_STATE                   (Hsm_StateIdType)0xFF
+
+/* No transition in the lookup tables */
+#define HSM_NO_TRANSITION              (uint8)0xFF
+
+/* One event, the data is free for the application (a button id, a key id ...) */
+typedef struct
+{
+    Hsm_EventIdType Id;
+    uint8 Data;
+} Hsm_EventType;
+
+/* Entry/exit actions and transition actions, called with the event which caused the transition */
+typedef void (*Hsm_ActionType)(const Hsm_EventType * EventPtr);
+
+/* Guards of the transitions, the transition is taken only if its guard returns TRUE */
+typedef boolean (*Hsm_GuardType)(const Hsm_EventType * EventPtr);
+
+/* One entry of the const state table */
+typedef struct
+{
+    /* Member contains the parent state, HSM_NO_STATE for a top level state */
+    Hsm_StateIdType Parent;
+    /* Member contains the child entered when the state is the target of a transition, HSM_NO_STATE for a leaf */
+    Hsm_StateIdType InitialChild;
+    /* Member contains the entry and exit actions, or NULL_PTR */
+    Hsm_ActionType Entry;
+    Hsm_ActionType Exit;
+} Hsm_StateType;
+
+/*
+ * One entry of the const transition table. A transition of a state is inherited by all its children, a child
+ * transition on the same event is tried first. With several transitions of the same state on the same event,
+ * the first one whose guard is TRUE is taken.
+ */
+typedef struct
+{
+    /* Member contains the state which handles the event */
+    Hsm_StateIdType Source;
+    /* Member contains the event */
+    Hsm_EventIdType Event;
+    /* Member contains the target state, HSM_NO_STATE for an internal transition (the action only) */
+    Hsm_StateIdType Target;
+    /* Member contains the guard, NULL_PTR for a transition always taken */
+    Hsm_GuardType Guard;
+    /* Member contains the action called between the exit and the entry actions, or NULL_PTR */
+    Hsm_ActionType Action;
+} Hsm_TransitionType;
+
+/* Const description of a state machine */
+typedef struct
+{
+    const Hsm_StateType * States;
+    uint8 NumberOfStates;
+    const Hsm_TransitionType * Transitions;
+    uint8 NumberOfTransitions;
+    uint8 NumberOfEvents;
+    Hsm_StateIdType InitialState;
+} Hsm_ConfigType;
+
+/*
+ * One state machine: its description, the RAM of its precomputed lookup tables and its event queue.
+ * All the arrays are static arrays of the application, the engine does not allocate memory.
+ */
+typedef struct
+{
+    const Hsm_ConfigType * Config;
+    /* NumberOfStates * NumberOfEvents entries: the first transition tried for a state and an event */
+    uint8 * Lookup;
+    /* NumberOfTransitions entries: the transition tried after a transition whose guard is FALSE */
+    uint8 * NextCandidate;
+    /* Event queue of QueueSize entries (a power of 2), one entry is kept free */
+    Hsm_EventType * Queue;
+    uint8 QueueSize;
+    volatile uint8 QueueHead;
+    volatile uint8 QueueTail;
+    /* Member contains the number of the events lost because the queue was full */
+    uint32 QueueOverflowCount;
+    /* Member contains the current leaf state */
+    Hsm_StateIdType Current;
+} Hsm_MachineType;
+
+/* Number of the lookup table entries of a state machine */
+#define HSM_LOOKUP_ENTRIES(STATES,EVENTS)   ((STATES) * (EVENTS))
+
+/*
+ * Description: Precompute the lookup tables of the machine from its const tables, then enter its initial
+ *              state (entry actions from the top level state down to the initial leaf state).
+ */
+void Hsm_Init(Hsm_MachineType * MachinePtr);
+
+/*
+ * Description: Process one event at once: the transition is found with one lookup (plus one step per FALSE
+ *              guard), then the exit actions, the transition action and the entry actions are called.
+ *              Returns FALSE if the event is not handled by the current state or its parents.
+ */
+boolean Hsm_Dispatch(Hsm_MachineType * MachinePtr, const Hsm_EventType * EventPtr);
+
+/*
+ * Description: Queue one event for Hsm_MainFunction, returns FALSE if the queue is full.
+ *              The producers of a machine shall not preempt each other (the Os tasks, or one interrupt).
+ */
+boolean Hsm_PostEvent(Hsm_MachineType * MachinePtr, Hsm_EventIdType EventId, uint8 Data);
+
+/* Description: Dispatch all the queued events in their order, called by the task which owns the machine */
+void Hsm_MainFunction(Hsm_MachineType * MachinePtr);
+
+/* Description: Check if a state is the current leaf state or one of its parents */
+boolean Hsm_IsInState(const Hsm_MachineType * MachinePtr, Hsm_StateIdType State);
+
+#endif /* HSM_H */
@@ -0,0 +1,18 @@
+/******************************************************************************
+ *
+ * Module: Hsm
+ *
+ * File Name: Hsm_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Hsm Module
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef HSM_CFG_H_
+#define HSM_CFG_H_
+
+/* Maximum nesting depth of the states (a top level state has the depth 1), sizes the entry path of a transition */
+#define HSM_MAX_DEPTH                        (4U)
+
+#endif /* HSM_CFG_H_ */
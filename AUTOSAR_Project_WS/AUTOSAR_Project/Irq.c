@@ -0,0 +1,197 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Interrupt Driver
+ *              (RAM vector table and NVIC configuration)
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Irq.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+#include "Det.h"
+#endif
+
+/* First vector that can be installed by Irq_Register ... vector 0 is the initial stack pointer and 1 is the reset */
+#define IRQ_FIRST_REGISTRABLE_VECTOR       (2U)
+
+/* First vector with a configurable priority in the System Handler Priority registers (MPU fault) */
+#define IRQ_FIRST_SYSTEM_HANDLER_VECTOR    (4U)
+
+/* The TM4C123GH6PM implements only the most significant bits of each priority byte */
+#define IRQ_PRIORITY_BITS_POS              (8U - IRQ_PRIORITY_BITS)
+
+/* APINT register key and PRIGROUP field position, PRIGROUP 4 means no sub-priority for 3 implemented bits */
+#define IRQ_APINT_VECTKEY                  (0x05FAUL << 16)
+#define IRQ_APINT_PRIGROUP_POS             8
+#define IRQ_PRIGROUP_VALUE                 (4U + IRQ_SUBPRIORITY_BITS)
+
+/* Byte access to the priority of a peripheral interrupt in the NVIC_PRIx registers */
+#define IRQ_PERIPHERAL_PRIORITY_REG(VECTOR) \
+    (((volatile uint8 *)&NVIC_PRI0_REG)[(VECTOR) - IRQ_FIRST_PERIPHERAL_VECTOR])
+
+/* Byte access to the priority of a system exception in the NVIC_SYSTEM_PRIx registers */
+#define IRQ_SYSTEM_PRIORITY_REG(VECTOR) \
+    (((volatile uint8 *)&NVIC_SYSTEM_PRI1_REG)[(VECTOR) - IRQ_FIRST_SYSTEM_HANDLER_VECTOR])
+
+/* Word access to the NVIC_ENx register which contains the enable bit of a peripheral interrupt */
+#define IRQ_ENABLE_REG(VECTOR) \
+    ((&NVIC_EN0_REG)[((VECTOR) - IRQ_FIRST_PERIPHERAL_VECTOR) >> 5])
+
+/* Enable bit of a peripheral interrupt in its NVIC_ENx register */
+#define IRQ_ENABLE_BIT(VECTOR)             (1UL << (((VECTOR) - IRQ_FIRST_PERIPHERAL_VECTOR) & 0x1F))
+
+/* Vector table in Flash defined in the startup code */
+extern void (* const g_pfnVectors[])(void);
+
+/* Vector table in SRAM ... the .vtable section is linked at 0x20000000 which respects the VTABLE alignment */
+#pragma DATA_SECTION(Irq_RamVectors, ".vtable")
+STATIC Irq_HandlerType Irq_RamVectors[IRQ_NUMBER_OF_VECTORS];
+
+STATIC uint8 Irq_Status = IRQ_NOT_INITIALIZED;
+
+/* Function to apply the configuration of one interrupt source: priority, sub-priority and enable */
+STATIC void Irq_ConfigureSource(const Irq_ConfigSource * Source)
+{
+    /* The group priority is placed above the sub-priority bits then both are aligned to the implemented bits */
+    uint8 priority = (uint8)(((Source->Priority << IRQ_SUBPRIORITY_BITS) | Source->SubPriority)
+                             << IRQ_PRIORITY_BITS_POS);
+
+    if(Source->Vector >= IRQ_FIRST_PERIPHERAL_VECTOR)
+    {
+        IRQ_PERIPHERAL_PRIORITY_REG(Source->Vector) = priority;
+
+        if(STD_ON == Source->Enable)
+        {
+            /* Writing 1 enables the interrupt and writing 0 has no effect, so no read-modify-write is needed */
+            IRQ_ENABLE_REG(Source->Vector) = IRQ_ENABLE_BIT(Source->Vector);
+        }
+        else
+        {
+            /* No Action Required ... the interrupt is enabled later by its driver */
+        }
+    }
+    else if(Source->Vector >= IRQ_FIRST_SYSTEM_HANDLER_VECTOR)
+    {
+        /* The system exceptions are enabled by their own drivers (e.g. SysTick by SysTick_Start) */
+        IRQ_SYSTEM_PRIORITY_REG(Source->Vector) = priority;
+    }
+    else
+    {
+        /* No Action Required ... Reset, NMI and Hard Fault have fixed priorities */
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to copy the vector table to SRAM, relocate it and apply the
+*              configured priority grouping, priorities and enables in one pass over
+*              the configured sources. Shall be called before any Irq_Register.
+************************************************************************************/
+void Irq_Init(const Irq_ConfigType * ConfigPtr)
+{
+    uint8 index;
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID, IRQ_INIT_SID,
+             IRQ_E_PARAM_CONFIG);
+    }
+    else
+#endif
+    {
+        /* Copy the vector table to SRAM then relocate the table, the vectors are fetched without the Flash wait states */
+        for(index = 0; index < IRQ_NUMBER_OF_VECTORS; index++)
+        {
+            Irq_RamVectors[index] = g_pfnVectors[index];
+        }
+        NVIC_SYSTEM_VTABLE = (uint32)Irq_RamVectors;
+
+        /* Split the implemented priority bits between the group priority and the sub-priority */
+        NVIC_SYSTEM_APINT = IRQ_APINT_VECTKEY | (IRQ_PRIGROUP_VALUE << IRQ_APINT_PRIGROUP_POS);
+
+        /* Apply the configuration of each interrupt source */
+        for(index = 0; index < IRQ_CONFIGURED_SOURCES; index++)
+        {
+            Irq_ConfigureSource(&ConfigPtr->Sources[index]);
+        }
+
+        Irq_Status = IRQ_INITIALIZED;
+    }
+}
+
+/************************************************************************************
+* Service Name: Irq_Register
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Vector - Vector number of the interrupt source
+*                  Handler - Interrupt service routine to be installed
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to install an ISR directly in the RAM vector table.
+************************************************************************************/
+void Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler)
+{
+    boolean error = FALSE;
+
+#if (IRQ_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (IRQ_NOT_INITIALIZED == Irq_Status)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID,
+                IRQ_REGISTER_SID, IRQ_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used vector is within the valid range */
+    if ((Vector < IRQ_FIRST_REGISTRABLE_VECTOR) || (Vector >= IRQ_NUMBER_OF_VECTORS))
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID,
+                IRQ_REGISTER_SID, IRQ_E_PARAM_VECTOR);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the handler is not a NULL_PTR */
+    if (NULL_PTR == Handler)
+    {
+        Det_ReportError(IRQ_MODULE_ID, IRQ_INSTANCE_ID,
+                IRQ_REGISTER_SID, IRQ_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* A single word store ... the new handler is used from the next exception entry */
+        Irq_RamVectors[Vector] = Handler;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
@@ -0,0 +1,173 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Interrupt Driver
+ *              (RAM vector table and NVIC configuration)
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef IRQ_H
+#define IRQ_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define IRQ_VENDOR_ID    (1000U)
+
+/* Irq Module Id ... Non AUTOSAR module, Id taken from the vendor specific range */
+#define IRQ_MODULE_ID    (250U)
+
+/* Irq Instance Id */
+#define IRQ_INSTANCE_ID  (0U)
+
+/*
+ * Macros for Irq Status
+ */
+#define IRQ_INITIALIZED                (1U)
+#define IRQ_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* Irq Pre-Compile Configuration Header file */
+#include "Irq_Cfg.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Irq Init */
+#define IRQ_INIT_SID                   (uint8)0x00
+
+/* Service ID for Irq Register */
+#define IRQ_REGISTER_SID               (uint8)0x01
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Irq_Init API service called with NULL pointer parameter */
+#define IRQ_E_PARAM_CONFIG             (uint8)0x10
+
+/* DET code to report Invalid Vector */
+#define IRQ_E_PARAM_VECTOR             (uint8)0x11
+
+/* DET code to report NULL handler */
+#define IRQ_E_PARAM_POINTER            (uint8)0x20
+
+/* API service used without module initialization */
+#define IRQ_E_UNINIT                   (uint8)0xF0
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of the implemented priority bits in the TM4C123GH6PM NVIC */
+#define IRQ_PRIORITY_BITS              (3U)
+
+/* Number of the TM4C123GH6PM vectors including the initial stack pointer */
+#define IRQ_NUMBER_OF_VECTORS          (155U)
+
+/* Vector number of the first peripheral interrupt (IRQ0) */
+#define IRQ_FIRST_PERIPHERAL_VECTOR    (16U)
+
+/* System exceptions vector numbers */
+#define IRQ_SVCALL_VECTOR              (Irq_VectorType)11
+#define IRQ_PENDSV_VECTOR              (Irq_VectorType)14
+#define IRQ_SYSTICK_VECTOR             (Irq_VectorType)15
+
+/* Peripheral interrupts vector numbers (IRQ number + 16) */
+#define IRQ_GPIO_PORTA_VECTOR          (Irq_VectorType)16
+#define IRQ_GPIO_PORTB_VECTOR          (Irq_VectorType)17
+#define IRQ_GPIO_PORTC_VECTOR          (Irq_VectorType)18
+#define IRQ_GPIO_PORTD_VECTOR          (Irq_VectorType)19
+#define IRQ_GPIO_PORTE_VECTOR          (Irq_VectorType)20
+#define IRQ_TIMER0A_VECTOR             (Irq_VectorType)35
+#define IRQ_TIMER0B_VECTOR             (Irq_VectorType)36
+#define IRQ_TIMER1A_VECTOR             (Irq_VectorType)37
+#define IRQ_TIMER1B_VECTOR             (Irq_VectorType)38
+#define IRQ_TIMER2A_VECTOR             (Irq_VectorType)39
+#define IRQ_TIMER2B_VECTOR             (Irq_VectorType)40
+#define IRQ_TIMER3A_VECTOR             (Irq_VectorType)51
+#define IRQ_TIMER3B_VECTOR             (Irq_VectorType)52
+#define IRQ_GPIO_PORTF_VECTOR          (Irq_VectorType)46
+#define IRQ_PWM0_GEN0_VECTOR           (Irq_VectorType)26
+#define IRQ_PWM0_GEN1_VECTOR           (Irq_VectorType)27
+#define IRQ_PWM0_GEN2_VECTOR           (Irq_VectorType)28
+#define IRQ_PWM0_GEN3_VECTOR           (Irq_VectorType)61
+#define IRQ_PWM1_GEN0_VECTOR           (Irq_VectorType)150
+#define IRQ_PWM1_GEN1_VECTOR           (Irq_VectorType)151
+#define IRQ_PWM1_GEN2_VECTOR           (Irq_VectorType)152
+#define IRQ_PWM1_GEN3_VECTOR           (Irq_VectorType)153
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for the vector number (exception number) used by the Irq APIs */
+typedef uint8 Irq_VectorType;
+
+/* Type definition for the NVIC priority level (0 is the highest priority) */
+typedef uint8 Irq_PriorityType;
+
+/* Type definition for an interrupt service routine */
+typedef void (*Irq_HandlerType)(void);
+
+typedef struct
+{
+    /* Member contains the vector number of the interrupt source */
+    Irq_VectorType Vector;
+    /* Member contains the group (preemption) priority of the interrupt source */
+    Irq_PriorityType Priority;
+    /* Member contains the sub-priority of the interrupt source */
+    Irq_PriorityType SubPriority;
+    /* Member contains STD_ON to enable the interrupt at Irq_Init */
+    uint8 Enable;
+} Irq_ConfigSource;
+
+/* Data Structure required for initializing the Irq Driver */
+typedef struct Irq_ConfigType
+{
+    Irq_ConfigSource Sources[IRQ_CONFIGURED_SOURCES];
+} Irq_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/************************************************************************************
+* Service Name: Irq_Init
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to copy the vector table to SRAM, relocate it and apply the
+*              configured priority grouping, priorities and enables in one pass over
+*              the configured sources. Shall be called before any Irq_Register.
+************************************************************************************/
+void Irq_Init(const Irq_ConfigType * ConfigPtr);
+
+/************************************************************************************
+* Service Name: Irq_Register
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): Vector - Vector number of the interrupt source
+*                  Handler - Interrupt service routine to be installed
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to install an ISR directly in the RAM vector table.
+************************************************************************************/
+void Irq_Register(Irq_VectorType Vector, Irq_HandlerType Handler);
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Irq and other modules */
+extern const Irq_ConfigType Irq_Configuration;
+
+#endif /* IRQ_H */
@@ -0,0 +1,81 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Interrupt Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef IRQ_CFG_H
+#define IRQ_CFG_H
+
+/* Pre-compile option for Development Error Detect */
+#define IRQ_DEV_ERROR_DETECT                (STD_ON)
+
+/*
+ * Number of the 3 implemented priority bits used as sub-priority (0 --> 3)
+ * The remaining most significant bits are the group (preemption) priority.
+ */
+#define IRQ_SUBPRIORITY_BITS                (0U)
+
+/* Number of the configured interrupt sources */
+#define IRQ_CONFIGURED_SOURCES              (6U)
+
+/*
+ * Configured interrupt sources
+ * Priority    : group priority (0 --> 2^(3 - IRQ_SUBPRIORITY_BITS) - 1), 0 is the highest priority
+ * SubPriority : order of the pending interrupts with the same group priority
+ * Enable      : enable the interrupt in the NVIC at Irq_Init (peripheral interrupts only,
+ *               the system exceptions are enabled by their own drivers)
+ */
+#define IrqConf_SYSTICK_PRIORITY            (3U)
+#define IrqConf_SYSTICK_SUBPRIORITY         (0U)
+#define IrqConf_SYSTICK_ENABLE              (STD_ON)
+
+/* GPIO PORTF edge interrupts (SW1), the ISR only queues the edge events for the tasks */
+#define IrqConf_GPIO_PORTF_PRIORITY         (2U)
+#define IrqConf_GPIO_PORTF_SUBPRIORITY      (0U)
+#define IrqConf_GPIO_PORTF_ENABLE           (STD_ON)
+
+/*
+ * Timer2A one-shot time-out (SW1 debounce lockout), same group priority as GPIO PORTF so the two
+ * handlers of the SW1 hybrid debounce never preempt each other
+ */
+#define IrqConf_TIMER2A_PRIORITY            (2U)
+#define IrqConf_TIMER2A_SUBPRIORITY         (0U)
+#define IrqConf_TIMER2A_ENABLE              (STD_ON)
+
+/* Timer3A periodic time-out (Led software PWM slots), above the other sources to keep the PWM edges steady */
+#define IrqConf_TIMER3A_PRIORITY            (1U)
+#define IrqConf_TIMER3A_SUBPRIORITY         (0U)
+#define IrqConf_TIMER3A_ENABLE              (STD_ON)
+
+/*
+ * PWM0 Generator2 and PWM1 Generator1 edge notifications (motor and fan/heater channels), the generator
+ * interrupts are enabled per channel by Pwm_EnableNotification
+ */
+#define IrqConf_PWM0_GEN2_PRIORITY          (2U)
+#define IrqConf_PWM0_GEN2_SUBPRIORITY       (0U)
+#define IrqConf_PWM0_GEN2_ENABLE            (STD_ON)
+
+#define IrqConf_PWM1_GEN1_PRIORITY          (2U)
+#define IrqConf_PWM1_GEN1_SUBPRIORITY       (0U)
+#define IrqConf_PWM1_GEN1_ENABLE            (STD_ON)
+
+/*
+ * List of the configured sources used to generate the PB structure and the compile-time checks:
+ * SOURCE(Name, OsIsr), OsIsr is STD_ON for an ISR calling the Os or BSW services (Dio, Led, Button, Latency ...),
+ * its priority shall respect OS_ISR_CEILING_PRIORITY.
+ */
+#define IRQ_CONFIGURED_SOURCES_LIST(SOURCE) \
+    SOURCE(SYSTICK,    STD_ON) \
+    SOURCE(GPIO_PORTF, STD_ON) \
+    SOURCE(TIMER2A,    STD_ON) \
+    SOURCE(TIMER3A,    STD_ON) \
+    SOURCE(PWM0_GEN2,  STD_ON) \
+    SOURCE(PWM1_GEN1,  STD_ON)
+
+#endif /* IRQ_CFG_H */
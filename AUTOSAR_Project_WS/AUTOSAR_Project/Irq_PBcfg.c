@@ -0,0 +1,32 @@
+ /******************************************************************************
+ *
+ * Module: Irq
+ *
+ * File Name: Irq_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Interrupt Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Irq.h"
+
+/* Check the configured levels of each source fit in the implemented priority bits */
+#define IRQ_CHECK_SOURCE_PRIORITY(NAME,OS_ISR) \
+    STATIC_ASSERT((IrqConf_##NAME##_PRIORITY < (1U << (IRQ_PRIORITY_BITS - IRQ_SUBPRIORITY_BITS))) \
+               && (IrqConf_##NAME##_SUBPRIORITY < (1U << IRQ_SUBPRIORITY_BITS)), Irq_##NAME##_PriorityOutOfGrouping);
+
+IRQ_CONFIGURED_SOURCES_LIST(IRQ_CHECK_SOURCE_PRIORITY)
+
+/* Number of the sources in the list */
+#define IRQ_COUNT_SOURCE(NAME,OS_ISR)   + 1U
+STATIC_ASSERT((0U IRQ_CONFIGURED_SOURCES_LIST(IRQ_COUNT_SOURCE)) == IRQ_CONFIGURED_SOURCES, Irq_SourcesListSizeMismatch);
+
+/* Configuration of one source in the PB structure */
+#define IRQ_SOURCE_CONFIG(NAME,OS_ISR) \
+    IRQ_##NAME##_VECTOR,IrqConf_##NAME##_PRIORITY,IrqConf_##NAME##_SUBPRIORITY,IrqConf_##NAME##_ENABLE,
+
+/* PB structure used with Irq_Init API */
+const Irq_ConfigType Irq_Configuration = {
+                                             IRQ_CONFIGURED_SOURCES_LIST(IRQ_SOURCE_CONFIG)
+                                         };
@@ -0,0 +1,206 @@
+/******************************************************************************
+ *
+ * Module: Keypad
+ *
+ * File Name: Keypad.c
+ *
+ * Description: Source file for Keypad Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Dio.h"
+#include "Gpt.h"
+#include "Keypad.h"
+
+#if (KEYPAD_ROWS < 1U) || (KEYPAD_ROWS > 8U) || (KEYPAD_COLUMNS < 1U) || (KEYPAD_COLUMNS > 8U) \
+    || ((KEYPAD_ROWS * KEYPAD_COLUMNS) > 32U)
+  #error "The keypad shall have 1 --> 8 rows and columns and up to 32 keys"
+#endif
+
+#if (KEYPAD_DEBOUNCE_THRESHOLD < 1U) || (KEYPAD_DEBOUNCE_THRESHOLD > 7U)
+  #error "The debounce threshold shall be 1 --> 7 scans"
+#endif
+
+/* Group levels with all the rows released and all the columns bits */
+#define KEYPAD_ALL_ROWS                (uint8)((1U << KEYPAD_ROWS) - 1U)
+#define KEYPAD_ALL_COLUMNS             (uint8)((1U << KEYPAD_COLUMNS) - 1U)
+
+/* Keys of one row in the key bitmap */
+#define KEYPAD_ROW_KEYS(MAP,ROW)       (uint8)(((MAP) >> ((ROW) * KEYPAD_COLUMNS)) & KEYPAD_ALL_COLUMNS)
+
+/* Settle time of a row in Gpt counts */
+#define KEYPAD_ROW_SETTLE_COUNTS       (KEYPAD_ROW_SETTLE_TIME_US * GPT_TIMESTAMP_TICKS_PER_US)
+
+/*
+ * Vertical counter of the matrix: bit n of Count0/Count1/Count2 are the 3 bits of the counter of key n,
+ * which counts the consecutive scans different from the debounced state of the key.
+ */
+static Keypad_KeyMapType Keypad_State = 0;
+static Keypad_KeyMapType Keypad_Count0 = 0;
+static Keypad_KeyMapType Keypad_Count1 = 0;
+static Keypad_KeyMapType Keypad_Count2 = 0;
+
+/* Keys pressed since the last Keypad_GetNewPresses call */
+static Keypad_KeyMapType Keypad_NewPresses = 0;
+
+/* Ambiguous keys of the last scan */
+static Keypad_KeyMapType Keypad_GhostKeys = 0;
+
+/* Select the counter bits when the threshold bit is set, else their complement */
+#define KEYPAD_MATCH_BITS(COUNT,BIT) \
+    (((KEYPAD_DEBOUNCE_THRESHOLD >> (BIT)) & 1U) ? (COUNT) : (Keypad_KeyMapType)(~(COUNT)))
+
+/*
+ * Function to scan the matrix: each row is driven low alone and the columns pulled low by its pressed keys
+ * are read, one group store and one group load per row whatever the number of the pressed keys.
+ */
+static Keypad_KeyMapType Keypad_ScanMatrix(void)
+{
+    Keypad_KeyMapType sample = 0;
+    uint8 row;
+
+    for(row = 0; row < KEYPAD_ROWS; row++)
+    {
+        uint32 start;
+
+        /* The other rows are released (open drain high) and do not load the columns */
+        Dio_WriteChannelGroup(KEYPAD_ROWS_GROUP,(Dio_PortLevelType)(KEYPAD_ALL_ROWS & ~(1U << row)));
+
+        start = Gpt_GetTimeStamp();
+        while((uint32)(Gpt_GetTimeStamp() - start) < KEYPAD_ROW_SETTLE_COUNTS)
+        {
+            /* Wait the columns to settle */
+        }
+
+        sample |= (Keypad_KeyMapType)((uint8)~Dio_ReadChannelGroup(KEYPAD_COLUMNS_GROUP) & KEYPAD_ALL_COLUMNS)
+                  << (row * KEYPAD_COLUMNS);
+    }
+
+    /* All the rows are released between the scans */
+    Dio_WriteChannelGroup(KEYPAD_ROWS_GROUP,KEYPAD_ALL_ROWS);
+
+    return sample;
+}
+
+#if (KEYPAD_GHOST_DETECTION == STD_ON)
+/*
+ * Function to find the ambiguous keys of a scan: two rows with two or more common pressed columns hold the
+ * corners of at least one rectangle, and any of its corners may be a ghost of the three others.
+ * A longer chain of pressed keys makes all its rows read the same columns, so checking pairs of rows is enough.
+ */
+static Keypad_KeyMapType Keypad_FindGhostKeys(Keypad_KeyMapType Sample)
+{
+    Keypad_KeyMapType ghost = 0;
+    uint8 row;
+    uint8 other;
+
+    for(row = 0; row < (KEYPAD_ROWS - 1U); row++)
+    {
+        uint8 keys = KEYPAD_ROW_KEYS(Sample,row);
+
+        /* A row with less than two pressed keys is not a side of a rectangle */
+        if(keys & (uint8)(keys - 1U))
+        {
+            for(other = (uint8)(row + 1U); other < KEYPAD_ROWS; other++)
+            {
+                uint8 common = (uint8)(keys & KEYPAD_ROW_KEYS(Sample,other));
+
+                if(common & (uint8)(common - 1U))
+                {
+                    ghost |= ((Keypad_KeyMapType)common << (row * KEYPAD_COLUMNS))
+                           | ((Keypad_KeyMapType)common << (other * KEYPAD_COLUMNS));
+                }
+                else
+                {
+                    /* No Action Required */
+                }
+            }
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return ghost;
+}
+#endif
+
+/*
+ * Function to debounce all the keys with one scan, the same vertical counter as the Button debounce groups
+ * on the key bitmap: the cost does not depend on the number of keys. Returns the keys which changed.
+ */
+static Keypad_KeyMapType Keypad_Debounce(Keypad_KeyMapType Sample)
+{
+    Keypad_KeyMapType delta = Sample ^ Keypad_State;
+    Keypad_KeyMapType count0 = Keypad_Count0;
+    Keypad_KeyMapType count1 = Keypad_Count1;
+    Keypad_KeyMapType reached;
+
+    /* 3 bits ripple increment of all the counters, then clear the counters of the stable keys */
+    Keypad_Count2 = (Keypad_Count2 ^ (count1 & count0)) & delta;
+    Keypad_Count1 = (count1 ^ count0) & delta;
+    Keypad_Count0 = ~count0 & delta;
+
+    /* Keys whose counter equals the threshold */
+    reached = KEYPAD_MATCH_BITS(Keypad_Count0,0) & KEYPAD_MATCH_BITS(Keypad_Count1,1)
+            & KEYPAD_MATCH_BITS(Keypad_Count2,2) & delta;
+
+    Keypad_State  ^= reached;
+    Keypad_Count0 &= ~reached;
+    Keypad_Count1 &= ~reached;
+    Keypad_Count2 &= ~reached;
+
+    return reached;
+}
+
+/*******************************************************************************************************************/
+void Keypad_Init(void)
+{
+    Dio_WriteChannelGroup(KEYPAD_ROWS_GROUP,KEYPAD_ALL_ROWS);
+
+    Keypad_State      = 0;
+    Keypad_Count0     = 0;
+    Keypad_Count1     = 0;
+    Keypad_Count2     = 0;
+    Keypad_NewPresses = 0;
+    Keypad_GhostKeys  = 0;
+}
+
+/*******************************************************************************************************************/
+void Keypad_RefreshState(void)
+{
+    Keypad_KeyMapType sample = Keypad_ScanMatrix();
+    Keypad_KeyMapType changed;
+
+#if (KEYPAD_GHOST_DETECTION == STD_ON)
+    /* The ambiguous keys are sampled at their debounced state, so they do not change */
+    Keypad_GhostKeys = Keypad_FindGhostKeys(sample);
+    sample = (sample & ~Keypad_GhostKeys) | (Keypad_State & Keypad_GhostKeys);
+#endif
+
+    changed = Keypad_Debounce(sample);
+    Keypad_NewPresses |= changed & Keypad_State;
+}
+
+/*******************************************************************************************************************/
+Keypad_KeyMapType Keypad_GetState(void)
+{
+    return Keypad_State;
+}
+
+/*******************************************************************************************************************/
+Keypad_KeyMapType Keypad_GetNewPresses(void)
+{
+    Keypad_KeyMapType presses = Keypad_NewPresses;
+
+    Keypad_NewPresses = 0;
+    return presses;
+}
+
+/*******************************************************************************************************************/
+Keypad_KeyMapType Keypad_GetGhostKeys(void)
+{
+    return Keypad_GhostKeys;
+}
+/*******************************************************************************************************************/
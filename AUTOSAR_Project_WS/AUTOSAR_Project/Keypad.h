@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Module: Keypad
+ *
+ * File Name: Keypad.h
+ *
+ * Description: Header file for Keypad Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+#ifndef KEYPAD_H
+#define KEYPAD_H
+
+#include "Std_Types.h"
+#include "Keypad_Cfg.h"
+
+/* Bitmap of the matrix keys, bit (Row * KEYPAD_COLUMNS + Column) is one key, 1 means pressed */
+typedef uint32 Keypad_KeyMapType;
+
+/* Id of the key of a row and a column, its bit in the key bitmaps */
+#define KEYPAD_KEY_ID(ROW,COLUMN)      (uint8)(((ROW) * KEYPAD_COLUMNS) + (COLUMN))
+
+/* Description: Release all the rows and clear the debounced state, called once after Dio_Init */
+void Keypad_Init(void);
+
+/*
+ * Description: This function is called every 20ms by Os Task, it scans the matrix one row at a time
+ *              with one group write of the rows and one group read of the columns per row, then debounces
+ *              all the keys together. Any number of keys can be pressed at the same time (n-key rollover).
+ */
+void Keypad_RefreshState(void);
+
+/* Description: Read the debounced state of all the keys */
+Keypad_KeyMapType Keypad_GetState(void);
+
+/* Description: Read the keys pressed since the previous call, each press is returned once */
+Keypad_KeyMapType Keypad_GetNewPresses(void);
+
+/* Description: Read the ambiguous (ghost) keys of the last scan, their debounced state is kept */
+Keypad_KeyMapType Keypad_GetGhostKeys(void);
+
+#endif /* KEYPAD_H */
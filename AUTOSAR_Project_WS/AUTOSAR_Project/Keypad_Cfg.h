@@ -0,0 +1,43 @@
+/******************************************************************************
+ *
+ * Module: Keypad
+ *
+ * File Name: Keypad_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Keypad Module
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef KEYPAD_CFG_H_
+#define KEYPAD_CFG_H_
+
+/* Number of the matrix rows and columns (up to 8 each and up to 32 keys) */
+#define KEYPAD_ROWS                          (4U)
+#define KEYPAD_COLUMNS                       (4U)
+
+/*
+ * Dio Channel Groups of the matrix: the rows are open drain outputs driven low one at a time,
+ * the columns are inputs with pull up resistors pulled low through the pressed keys of the driven row.
+ * Row n / column n is bit n of the group level.
+ */
+#define KEYPAD_ROWS_GROUP                    DioConf_KEYPAD_ROWS_GROUP_PTR
+#define KEYPAD_COLUMNS_GROUP                 DioConf_KEYPAD_COLUMNS_GROUP_PTR
+
+/* Time between driving a row and reading the columns, for the columns released by the previous row to rise */
+#define KEYPAD_ROW_SETTLE_TIME_US            (2U)
+
+/*
+ * The whole matrix is debounced by a vertical counter, a key changes its debounced state after THRESHOLD
+ * consecutive scans (1 --> 7) at the new level.
+ */
+#define KEYPAD_DEBOUNCE_THRESHOLD            (2U)
+
+/*
+ * Pre-compile option for the ghost detection of a matrix without diodes: three pressed keys at the corners
+ * of a rectangle make the fourth corner read as pressed. The keys of such rectangles are ambiguous and keep
+ * their debounced state until the scan is unambiguous again. STD_OFF for a matrix with a diode per key.
+ */
+#define KEYPAD_GHOST_DETECTION               (STD_ON)
+
+#endif /* KEYPAD_CFG_H_ */
@@ -0,0 +1,218 @@
+/******************************************************************************
+ *
+ * Module: Latency
+ *
+ * File Name: Latency.c
+ *
+ * Description: Source file for Latency Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Dio.h"
+#include "Gpt.h"
+#include "Latency.h"
+
+#if (LATENCY_HISTOGRAM_BINS < 2U) || (LATENCY_HISTOGRAM_BINS > 32U)
+  #error "The histograms shall have 2 --> 32 bins"
+#endif
+
+/*
+ * Disable the interrupts around the short updates shared by the interrupts and the tasks, the PRIMASK value is
+ * saved and restored so the interrupts stay disabled when called inside an Os critical section
+ */
+#define Latency_EnterCritical(STATE)   ((STATE) = _disable_IRQ())
+#define Latency_ExitCritical(STATE)    _restore_interrupts(STATE)
+
+/* Quiet time and time-out in Gpt counts */
+#define LATENCY_QUIET_COUNTS           (LATENCY_INPUT_QUIET_TIME_US * GPT_TIMESTAMP_TICKS_PER_US)
+#define LATENCY_TIMEOUT_COUNTS         (LATENCY_TIMEOUT_MS * 1000U * GPT_TIMESTAMP_TICKS_PER_US)
+
+/* No measurement is running */
+#define LATENCY_IDLE                   (uint8)0xFF
+
+/* Next stage of the running measurement, or LATENCY_IDLE */
+static uint8 Latency_NextStage = LATENCY_IDLE;
+
+/* Time stamps of the recorded stages of the running measurement */
+static uint32 Latency_StageTime[LATENCY_STAGES];
+
+/* Time stamp of the last edge of the input to the other level, for the quiet time */
+static uint32 Latency_InactiveTime = 0;
+
+static Latency_HistogramType Latency_Histograms[LATENCY_SEGMENTS];
+static uint32 Latency_DroppedCount = 0;
+
+/* Function to add one latency in Gpt counts to a histogram */
+static void Latency_AddSample(Latency_HistogramType * Histogram, uint32 Counts)
+{
+    uint32 us = Counts / GPT_TIMESTAMP_TICKS_PER_US;
+    uint32 rest = us;
+    uint8 bin = 0;
+
+    /* Bin of the highest set bit, so the cost is bounded by the 32 bits of the latency */
+    while((rest != 0U) && (bin < (LATENCY_HISTOGRAM_BINS - 1U)))
+    {
+        rest >>= 1;
+        bin++;
+    }
+    Histogram->Bins[bin]++;
+
+    if((0U == Histogram->Count) || (us < Histogram->MinUs))
+    {
+        Histogram->MinUs = us;
+    }
+    if(us > Histogram->MaxUs)
+    {
+        Histogram->MaxUs = us;
+    }
+    Histogram->SumUs += us;
+    Histogram->Count++;
+}
+
+/*******************************************************************************************************************/
+void Latency_Reset(void)
+{
+    uint32 primask;
+    uint8 segment;
+    uint8 bin;
+
+    Latency_EnterCritical(primask);
+    for(segment = 0; segment < LATENCY_SEGMENTS; segment++)
+    {
+        Latency_Histograms[segment].Count = 0;
+        Latency_Histograms[segment].MinUs = 0;
+        Latency_Histograms[segment].MaxUs = 0;
+        Latency_Histograms[segment].SumUs = 0;
+        for(bin = 0; bin < LATENCY_HISTOGRAM_BINS; bin++)
+        {
+            Latency_Histograms[segment].Bins[bin] = 0;
+        }
+    }
+    Latency_DroppedCount = 0;
+    Latency_NextStage = LATENCY_IDLE;
+    Latency_ExitCritical(primask);
+}
+
+/*******************************************************************************************************************/
+void Latency_InputEdge(uint8 ChannelId, uint8 Level, uint32 TimeStamp)
+{
+    uint32 primask;
+
+    if(LATENCY_INPUT_CHANNEL != ChannelId)
+    {
+        /* No Action Required ... not the instrumented input */
+    }
+    else if(LATENCY_INPUT_LEVEL != Level)
+    {
+        Latency_InactiveTime = TimeStamp;
+    }
+    else if((uint32)(TimeStamp - Latency_InactiveTime) >= LATENCY_QUIET_COUNTS)
+    {
+        Latency_EnterCritical(primask);
+        /*
+         * A new press restarts a measurement which did not pass its edge stage (a glitch rejected by the
+         * debounce), or which did not end within the time-out
+         */
+        if((LATENCY_IDLE != Latency_NextStage) && (LATENCY_STAGE_DEBOUNCED != Latency_NextStage)
+           && ((uint32)(TimeStamp - Latency_StageTime[LATENCY_STAGE_EDGE]) < LATENCY_TIMEOUT_COUNTS))
+        {
+            /* No Action Required ... the measurement of the previous press is still running */
+        }
+        else
+        {
+            if(LATENCY_IDLE != Latency_NextStage)
+            {
+                Latency_DroppedCount++;
+            }
+            Latency_StageTime[LATENCY_STAGE_EDGE] = TimeStamp;
+            Latency_NextStage = LATENCY_STAGE_DEBOUNCED;
+        }
+        Latency_ExitCritical(primask);
+    }
+    else
+    {
+        /* No Action Required ... a bounce of a release */
+    }
+}
+
+/*******************************************************************************************************************/
+void Latency_MarkStage(uint8 Stage, uint32 TimeStamp)
+{
+    uint32 primask;
+
+    Latency_EnterCritical(primask);
+    if((Stage == Latency_NextStage) && (Stage < LATENCY_STAGE_OUTPUT))
+    {
+        Latency_StageTime[Stage] = TimeStamp;
+        Latency_NextStage = (uint8)(Stage + 1U);
+    }
+    else
+    {
+        /* No Action Required ... no running measurement, or a stage already recorded */
+    }
+    Latency_ExitCritical(primask);
+}
+
+/*******************************************************************************************************************/
+void Latency_OutputWrite(uint8 PortId, uint8 Pins, uint32 TimeStamp)
+{
+    uint32 primask;
+
+    if((LATENCY_OUTPUT_PORT == PortId) && (0U != (Pins & (1U << LATENCY_OUTPUT_PIN))))
+    {
+        Latency_EnterCritical(primask);
+        if(LATENCY_STAGE_OUTPUT == Latency_NextStage)
+        {
+            uint8 segment;
+
+            Latency_StageTime[LATENCY_STAGE_OUTPUT] = TimeStamp;
+
+            /* Segment n is the time between the stages n and n + 1 */
+            for(segment = 0; segment < LATENCY_SEGMENT_TOTAL; segment++)
+            {
+                Latency_AddSample(&Latency_Histograms[segment],
+                                  Latency_StageTime[segment + 1U] - Latency_StageTime[segment]);
+            }
+            Latency_AddSample(&Latency_Histograms[LATENCY_SEGMENT_TOTAL],
+                              TimeStamp - Latency_StageTime[LATENCY_STAGE_EDGE]);
+            Latency_NextStage = LATENCY_IDLE;
+        }
+        else
+        {
+            /* No Action Required ... a write of the output not caused by a measured press */
+        }
+        Latency_ExitCritical(primask);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*******************************************************************************************************************/
+boolean Latency_GetHistogram(uint8 SegmentId, Latency_HistogramType * HistogramPtr)
+{
+    uint32 primask;
+    boolean valid = FALSE;
+
+    if((SegmentId < LATENCY_SEGMENTS) && (NULL_PTR != HistogramPtr))
+    {
+        /* A measurement ending during the copy would give a histogram with a Count not matching its bins */
+        Latency_EnterCritical(primask);
+        *HistogramPtr = Latency_Histograms[SegmentId];
+        Latency_ExitCritical(primask);
+        valid = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return valid;
+}
+
+/*******************************************************************************************************************/
+uint32 Latency_GetDroppedCount(void)
+{
+    return Latency_DroppedCount;
+}
@@ -0,0 +1,88 @@
+/******************************************************************************
+ *
+ * Module: Latency
+ *
+ * File Name: Latency.h
+ *
+ * Description: Header file for Latency Module.
+ *
+ * Author: agent
+ ******************************************************************************/
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include "Std_Types.h"
+#include "Latency_Cfg.h"
+
+/*
+ * Stages of a measurement in their order: the input edge (Dio interrupt), the debounced press (Button),
+ * the application reaction (App), the output write request (Led) and the output pin write (Dio).
+ */
+#define LATENCY_STAGE_EDGE             (uint8)0x00
+#define LATENCY_STAGE_DEBOUNCED        (uint8)0x01
+#define LATENCY_STAGE_APP              (uint8)0x02
+#define LATENCY_STAGE_REQUEST          (uint8)0x03
+#define LATENCY_STAGE_OUTPUT           (uint8)0x04
+#define LATENCY_STAGES                 (5U)
+
+/* Histograms: one per segment between two consecutive stages, then the whole edge to output latency */
+#define LATENCY_SEGMENT_DEBOUNCE       (uint8)0x00   /* Edge --> debounced press */
+#define LATENCY_SEGMENT_DISPATCH       (uint8)0x01   /* Debounced press --> application reaction */
+#define LATENCY_SEGMENT_ACTION         (uint8)0x02   /* Application reaction --> output write request */
+#define LATENCY_SEGMENT_OUTPUT         (uint8)0x03   /* Output write request --> pin written */
+#define LATENCY_SEGMENT_TOTAL          (uint8)0x04   /* Edge --> pin written */
+#define LATENCY_SEGMENTS               (5U)
+
+/* Histogram of one segment, the latencies are in microseconds */
+typedef struct
+{
+    /* Member contains the number of the measurements */
+    uint32 Count;
+    /* Member contains the shortest and the longest latency */
+    uint32 MinUs;
+    uint32 MaxUs;
+    /* Member contains the sum of the latencies, for the mean latency */
+    uint32 SumUs;
+    /* Member contains the number of the measurements of each bin (see LATENCY_HISTOGRAM_BINS) */
+    uint32 Bins[LATENCY_HISTOGRAM_BINS];
+} Latency_HistogramType;
+
+/*
+ * Instrumentation hooks called by the modules of the SW1 to LED1 path. The time stamps are Gpt time stamps,
+ * their expressions are not evaluated when the instrumentation is off.
+ */
+#if (LATENCY_INSTRUMENTATION == STD_ON)
+#define LATENCY_INPUT_EDGE(CHANNEL,LEVEL,TIMESTAMP)   Latency_InputEdge(CHANNEL,LEVEL,TIMESTAMP)
+#define LATENCY_MARK_STAGE(STAGE,TIMESTAMP)           Latency_MarkStage(STAGE,TIMESTAMP)
+#define LATENCY_OUTPUT_WRITE(PORT,PINS,TIMESTAMP)     Latency_OutputWrite(PORT,PINS,TIMESTAMP)
+#else
+#define LATENCY_INPUT_EDGE(CHANNEL,LEVEL,TIMESTAMP)
+#define LATENCY_MARK_STAGE(STAGE,TIMESTAMP)
+#define LATENCY_OUTPUT_WRITE(PORT,PINS,TIMESTAMP)
+#endif
+
+/* Description: Clear all the histograms and drop the current measurement */
+void Latency_Reset(void);
+
+/*
+ * Description: Input edge hook of the Dio port interrupt, an edge of LATENCY_INPUT_CHANNEL to
+ *              LATENCY_INPUT_LEVEL starts a measurement unless one is already running (a bounce).
+ */
+void Latency_InputEdge(uint8 ChannelId, uint8 Level, uint32 TimeStamp);
+
+/* Description: Stage hook, records the time of a stage of the running measurement if it is the next stage */
+void Latency_MarkStage(uint8 Stage, uint32 TimeStamp);
+
+/*
+ * Description: Output write hook, a write of pins of a port which includes the output pin ends the running
+ *              measurement once its request is recorded, and adds its segments to the histograms.
+ */
+void Latency_OutputWrite(uint8 PortId, uint8 Pins, uint32 TimeStamp);
+
+/* Description: Copy the histogram of a segment (LATENCY_SEGMENT_x), returns FALSE for an invalid segment */
+boolean Latency_GetHistogram(uint8 SegmentId, Latency_HistogramType * HistogramPtr);
+
+/* Description: Read the number of the measurements dropped after LATENCY_TIMEOUT_MS */
+uint32 Latency_GetDroppedCount(void);
+
+#endif /* LATENCY_H */
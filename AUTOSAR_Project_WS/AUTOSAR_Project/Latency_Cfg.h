@@ -0,0 +1,44 @@
+/******************************************************************************
+ *
+ * Module: Latency
+ *
+ * File Name: Latency_Cfg.h
+ *
+ * Description: Header file for Pre-Compiler configuration used by Latency Module
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef LATENCY_CFG_H_
+#define LATENCY_CFG_H_
+
+/*
+ * Pre-compile option for the input to output latency instrumentation. With STD_OFF the hooks in Dio, Button,
+ * App and Led are empty macros and add no code.
+ */
+#define LATENCY_INSTRUMENTATION              (STD_ON)
+
+/* Input edge which starts a measurement: the press edge of SW1 (pull up, pressed is low) */
+#define LATENCY_INPUT_CHANNEL                DioConf_SW1_CHANNEL_ID_INDEX
+#define LATENCY_INPUT_LEVEL                  (STD_LOW)
+
+/*
+ * Time the input shall stay at the other level before an edge starts a measurement, so the bounces of a
+ * release do not start one. The bounces of a press are ignored as the measurement is already running.
+ */
+#define LATENCY_INPUT_QUIET_TIME_US          (10000U)
+
+/* Output pin whose write ends a measurement: LED1 */
+#define LATENCY_OUTPUT_PORT                  DioConf_LED1_PORT_NUM
+#define LATENCY_OUTPUT_PIN                   DioConf_LED1_CHANNEL_NUM
+
+/*
+ * Number of the bins of each histogram: bin 0 counts the latencies below 1us and bin n (n > 0) the latencies
+ * of 2^(n-1) --> 2^n - 1 us. The last bin also counts all the longer latencies.
+ */
+#define LATENCY_HISTOGRAM_BINS               (20U)
+
+/* A measurement not ended within this time (a press glitch rejected by the debounce) is dropped */
+#define LATENCY_TIMEOUT_MS                   (1000U)
+
+#endif /* LATENCY_CFG_H_ */
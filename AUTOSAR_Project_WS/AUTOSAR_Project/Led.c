@@ -14,31 +14,455 @@
  ******************************************************************************/
 
 #include "Dio.h"
+#include "Gpt.h"
 #include "Led.h"
+#include "Latency.h"
+
+/*
+ * LED channel access: the Dio process image when enabled (written to the pin at the end of the Os tick),
+ * else the compile-time accessors, else the AUTOSAR channel APIs.
+ */
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+#define LED_WRITE(LEVEL)   Dio_WriteChannelImage(DioConf_LED1_CHANNEL_ID_INDEX,LEVEL)
+#define LED_READ()         Dio_ReadChannelImage(DioConf_LED1_CHANNEL_ID_INDEX)
+#define LED_FLIP()         Dio_FlipChannelImage(DioConf_LED1_CHANNEL_ID_INDEX)
+#elif (DIO_PRE_COMPILE_CHANNELS_API == STD_ON)
+#define LED_WRITE(LEVEL)   Dio_Write_LED1(LEVEL)
+#define LED_READ()         Dio_Read_LED1()
+#define LED_FLIP()         Dio_Flip_LED1()
+#else
+#define LED_WRITE(LEVEL)   Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LEVEL)
+#define LED_READ()         Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX)
+#define LED_FLIP()         Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX)
+#endif
+
+/* Immediate LED channel access, the pin is written at once even with the Dio process image */
+#if (DIO_PRE_COMPILE_CHANNELS_API == STD_ON)
+#define LED_FLIP_NOW()     Dio_Flip_LED1()
+#else
+#define LED_FLIP_NOW()     Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX)
+#endif
 
 /*********************************************************************************************/
 void Led_SetOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    LED_WRITE(LED_ON);  /* LED ON */
 }
 
 /*********************************************************************************************/
 void Led_SetOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    LED_WRITE(LED_OFF); /* LED OFF */
 }
 
 /*********************************************************************************************/
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+#if (DIO_OUTPUT_SHADOW_API == STD_ON)
+    /* Re-write the last written levels of all the outputs from the Dio shadow, one store per port */
+    Dio_RefreshOutputs();
+#else
+    Dio_LevelType state = LED_READ();
+    LED_WRITE(state); /* re-write the same value */
+#endif
 }
 
 /*********************************************************************************************/
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    (void)LED_FLIP();
+    LATENCY_MARK_STAGE(LATENCY_STAGE_REQUEST,Gpt_GetTimeStamp());
+#if (DIO_PROCESS_IMAGE_API == STD_OFF)
+    LATENCY_OUTPUT_WRITE(LED_PORT,(uint8)(1U << LED_PIN_NUM),Gpt_GetTimeStamp());
+#endif
 }
 
 /*********************************************************************************************/
+void Led_ToggleNow(void)
+{
+    (void)LED_FLIP_NOW();
+    LATENCY_MARK_STAGE(LATENCY_STAGE_REQUEST,Gpt_GetTimeStamp());
+    LATENCY_OUTPUT_WRITE(LED_PORT,(uint8)(1U << LED_PIN_NUM),Gpt_GetTimeStamp());
+}
+
+/*********************************************************************************************/
+
+#if (LED_ENGINE_API == STD_ON)
+
+#if (LED_PWM_STEPS < 2U) || (LED_PWM_STEPS > 255U)
+  #error "LED_PWM_STEPS shall be 2 --> 255"
+#endif
+
+/* Timer3A period of one PWM slot in system clock counts */
+#define LED_PWM_SLOT_PERIOD            (MCU_RUN_CLOCK_FREQ_HZ / (LED_PWM_STEPS * LED_PWM_FRAME_RATE_HZ))
+
+/* Configuration of one engine LED: its port and its pin */
+typedef struct
+{
+    Dio_PortType Port;
+    uint8 Bit;
+} Led_EngineConfigType;
+
+/* State of one engine LED */
+typedef struct
+{
+    /* Running pattern, NULL_PTR for a fixed brightness */
+    const Led_PatternType * Pattern;
+    /* Current step of the pattern and time spent in it */
+    uint8 Step;
+    uint16 Time;
+    /* Brightness at the start of the current step */
+    uint8 From;
+    /* Current brightness */
+    uint8 Brightness;
+    /* Index of the LED port in Led_EnginePorts */
+    uint8 EnginePort;
+} Led_EngineStateType;
+
+#define LED_ENGINE_CONFIG(NAME,PORT,PIN)  {PORT, (uint8)(1U << (PIN))},
+
+static const Led_EngineConfigType Led_EngineLeds[LED_ENGINE_LEDS] = {
+    LED_ENGINE_LEDS_LIST(LED_ENGINE_CONFIG)
+};
+
+static Led_EngineStateType Led_EngineState[LED_ENGINE_LEDS];
+
+/* One channel group per port with engine LEDs (offset 0, mask of its engine LEDs), at most one port per LED */
+static Dio_ChannelGroupType Led_EnginePorts[LED_ENGINE_LEDS];
+static uint8 Led_EnginePortCount = 0;
+
+/*
+ * Port levels of each PWM slot, LED n is ON in the slots below its brightness. Two tables: the interrupt
+ * outputs the active one while Led_MainFunction prepares the other, they are swapped at the end of a frame.
+ */
+static uint8 Led_SlotTable[2][LED_ENGINE_LEDS][LED_PWM_STEPS];
+static volatile uint8 Led_ActiveTable = 0;
+static volatile boolean Led_SwapRequest = FALSE;
+static uint8 Led_PwmSlot = 0;
+
+/* Timer3A state and the need of the PWM for the last prepared table */
+static boolean Led_PwmRunning = FALSE;
+static boolean Led_PwmNeeded = FALSE;
+
+/* TRUE when a brightness changed since the last prepared table */
+static boolean Led_TableDirty = FALSE;
+
+/* Predefined patterns */
+static const Led_PatternStepType Led_BlinkSteps[] = {
+    {LED_PWM_STEPS, FALSE, 500U},
+    {0U,            FALSE, 500U}
+};
+static const Led_PatternStepType Led_BreatheSteps[] = {
+    {LED_PWM_STEPS, TRUE, 1500U},
+    {0U,            TRUE, 1500U}
+};
+static const Led_PatternStepType Led_HeartbeatSteps[] = {
+    {LED_PWM_STEPS, FALSE, 120U},
+    {0U,            FALSE, 120U},
+    {LED_PWM_STEPS, FALSE, 120U},
+    {0U,            FALSE, 840U}
+};
+
+const Led_PatternType Led_BlinkPattern     = {Led_BlinkSteps, 2U, TRUE};
+const Led_PatternType Led_BreathePattern   = {Led_BreatheSteps, 2U, TRUE};
+const Led_PatternType Led_HeartbeatPattern = {Led_HeartbeatSteps, 4U, TRUE};
+
+/* Function to write one slot of the active table, one masked store per port whatever the number of LEDs */
+static void Led_WriteSlot(uint8 Slot)
+{
+    uint8 port;
+
+    for(port = 0; port < Led_EnginePortCount; port++)
+    {
+        Dio_WriteChannelGroup(&Led_EnginePorts[port],Led_SlotTable[Led_ActiveTable][port][Slot]);
+    }
+}
+
+/* Function called from the Timer3A interrupt at each PWM slot */
+static void Led_PwmSlotHandler(void)
+{
+    Led_WriteSlot(Led_PwmSlot);
+
+    Led_PwmSlot++;
+    if(Led_PwmSlot >= LED_PWM_STEPS)
+    {
+        Led_PwmSlot = 0;
+        /* A new table is only taken at the end of a frame, so no frame mixes two brightness values */
+        if(TRUE == Led_SwapRequest)
+        {
+            Led_ActiveTable ^= 1U;
+            Led_SwapRequest = FALSE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Function to prepare a slot table from the brightness values, returns TRUE if a LED is neither fully OFF nor ON */
+static boolean Led_BuildTable(uint8 Table)
+{
+    boolean pwm = FALSE;
+    uint8 port;
+    uint8 slot;
+    uint8 led;
+
+    for(port = 0; port < Led_EnginePortCount; port++)
+    {
+        for(slot = 0; slot < LED_PWM_STEPS; slot++)
+        {
+            Led_SlotTable[Table][port][slot] = 0;
+        }
+    }
+
+    for(led = 0; led < LED_ENGINE_LEDS; led++)
+    {
+        uint8 brightness = Led_EngineState[led].Brightness;
+
+        for(slot = 0; slot < brightness; slot++)
+        {
+            Led_SlotTable[Table][Led_EngineState[led].EnginePort][slot] |= Led_EngineLeds[led].Bit;
+        }
+        if((0U != brightness) && (LED_PWM_STEPS != brightness))
+        {
+            pwm = TRUE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return pwm;
+}
+
+/* Function to set the brightness of an engine LED */
+static void Led_UpdateBrightness(uint8 LedId, uint8 Brightness)
+{
+    if(Brightness != Led_EngineState[LedId].Brightness)
+    {
+        Led_EngineState[LedId].Brightness = Brightness;
+        Led_TableDirty = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/* Function to advance the pattern of an engine LED by Elapsed milli-seconds and compute its brightness */
+static void Led_AdvancePattern(uint8 LedId, uint16 Elapsed)
+{
+    Led_EngineStateType * Led = &Led_EngineState[LedId];
+    const Led_PatternStepType * Step = &Led->Pattern->Steps[Led->Step];
+    uint8 brightness;
+
+    Led->Time += Elapsed;
+    while((NULL_PTR != Step) && (Led->Time >= Step->Time))
+    {
+        /* End of the step */
+        Led->Time -= Step->Time;
+        Led->From  = Step->Brightness;
+        Led->Step++;
+        if(Led->Step >= Led->Pattern->NumberOfSteps)
+        {
+            Led->Step = 0;
+            if(FALSE == Led->Pattern->Repeat)
+            {
+                /* The last brightness is kept */
+                Led->Pattern = NULL_PTR;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Step = (NULL_PTR != Led->Pattern) ? &Led->Pattern->Steps[Led->Step] : NULL_PTR;
+    }
+
+    if(NULL_PTR == Step)
+    {
+        brightness = Led->From;
+    }
+    else if(TRUE == Step->Fade)
+    {
+        brightness = (uint8)((sint32)Led->From
+                   + ((((sint32)Step->Brightness - (sint32)Led->From) * (sint32)Led->Time) / (sint32)Step->Time));
+    }
+    else
+    {
+        brightness = Step->Brightness;
+    }
+    Led_UpdateBrightness(LedId,brightness);
+}
+
+/* Function to check that a pattern has steps and none of them lasts 0 milli-seconds,
+   a zero duration step would never end the step loop of Led_AdvancePattern */
+static boolean Led_PatternValid(const Led_PatternType * PatternPtr)
+{
+    boolean valid = (boolean)((NULL_PTR != PatternPtr) && (NULL_PTR != PatternPtr->Steps)
+                           && (0U != PatternPtr->NumberOfSteps));
+    uint8 step;
+
+    for(step = 0; (TRUE == valid) && (step < PatternPtr->NumberOfSteps); step++)
+    {
+        if(0U == PatternPtr->Steps[step].Time)
+        {
+            valid = FALSE;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+    return valid;
+}
+
+/*********************************************************************************************/
+void Led_Init(void)
+{
+    uint8 led;
+    uint8 port;
+
+    /* Group the engine LEDs per port */
+    Led_EnginePortCount = 0;
+    for(led = 0; led < LED_ENGINE_LEDS; led++)
+    {
+        for(port = 0; port < Led_EnginePortCount; port++)
+        {
+            if(Led_EnginePorts[port].PortIndex == Led_EngineLeds[led].Port)
+            {
+                break;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+        if(port == Led_EnginePortCount)
+        {
+            Led_EnginePorts[port].PortIndex = Led_EngineLeds[led].Port;
+            Led_EnginePorts[port].mask      = 0;
+            Led_EnginePorts[port].offset    = 0;
+            Led_EnginePortCount++;
+        }
+        else
+        {
+            /* No Action Required */
+        }
+        Led_EnginePorts[port].mask |= Led_EngineLeds[led].Bit;
+
+        Led_EngineState[led].Pattern    = NULL_PTR;
+        Led_EngineState[led].Step       = 0;
+        Led_EngineState[led].Time       = 0;
+        Led_EngineState[led].From       = 0;
+        Led_EngineState[led].Brightness = 0;
+        Led_EngineState[led].EnginePort = port;
+    }
+
+    /* All the engine LEDs OFF, the PWM timer is started by Led_MainFunction when needed */
+    Led_ActiveTable = 0;
+    Led_SwapRequest = FALSE;
+    Led_PwmRunning  = FALSE;
+    Led_PwmNeeded   = FALSE;
+    Led_TableDirty  = FALSE;
+    (void)Led_BuildTable(0U);
+    Led_WriteSlot(0U);
+}
+
+/*********************************************************************************************/
+void Led_SetBrightness(uint8 LedId, uint8 Brightness)
+{
+    if(LedId < LED_ENGINE_LEDS)
+    {
+        Led_EngineState[LedId].Pattern = NULL_PTR;
+        Led_UpdateBrightness(LedId,(Brightness > LED_PWM_STEPS) ? (uint8)LED_PWM_STEPS : Brightness);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+void Led_StartPattern(uint8 LedId, const Led_PatternType * PatternPtr)
+{
+    if((LedId < LED_ENGINE_LEDS) && (TRUE == Led_PatternValid(PatternPtr)))
+    {
+        Led_EngineState[LedId].Pattern = PatternPtr;
+        Led_EngineState[LedId].Step    = 0;
+        Led_EngineState[LedId].Time    = 0;
+        Led_EngineState[LedId].From    = Led_EngineState[LedId].Brightness;
+        Led_AdvancePattern(LedId,0U);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/*********************************************************************************************/
+void Led_MainFunction(void)
+{
+    uint8 led;
+
+    for(led = 0; led < LED_ENGINE_LEDS; led++)
+    {
+        if(NULL_PTR != Led_EngineState[led].Pattern)
+        {
+            Led_AdvancePattern(led,LED_ENGINE_PERIOD_MS);
+        }
+        else
+        {
+            /* No Action Required ... fixed brightness */
+        }
+    }
+
+    /* The inactive table can only be prepared again after the interrupt took the previous one */
+    if((TRUE == Led_TableDirty) && (FALSE == Led_SwapRequest))
+    {
+        Led_PwmNeeded  = Led_BuildTable((uint8)(Led_ActiveTable ^ 1U));
+        Led_TableDirty = FALSE;
+
+        if(TRUE == Led_PwmRunning)
+        {
+            Led_SwapRequest = TRUE;
+        }
+        else
+        {
+            Led_ActiveTable ^= 1U;
+            if(TRUE == Led_PwmNeeded)
+            {
+                Led_PwmSlot    = 0;
+                Led_PwmRunning = TRUE;
+                Gpt_StartPeriodic(LED_PWM_SLOT_PERIOD,Led_PwmSlotHandler);
+            }
+            else
+            {
+                /* All the LEDs fully OFF or ON ... the first slot holds their levels */
+                Led_WriteSlot(0U);
+            }
+        }
+    }
+    else if((TRUE == Led_PwmRunning) && (FALSE == Led_SwapRequest) && (FALSE == Led_PwmNeeded))
+    {
+        /* The active table has no PWM levels since the last frame, the static levels replace the interrupt */
+        Gpt_StopPeriodic();
+        Led_PwmRunning = FALSE;
+        Led_WriteSlot(0U);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+#endif
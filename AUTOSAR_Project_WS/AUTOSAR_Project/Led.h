@@ -23,7 +23,56 @@ void Led_SetOff(void);
 /*Description: Toggle the LED state */
 void Led_Toggle(void);
 
+/* Description: Toggle the LED pin immediately, bypassing the Dio process image (can be called from an ISR) */
+void Led_ToggleNow(void);
+
 /* Description: Refresh the LED state */
 void Led_RefreshOutput(void);
 
+#if (LED_ENGINE_API == STD_ON)
+/* One step of a LED pattern */
+typedef struct
+{
+    /* Member contains the brightness (0 --> LED_PWM_STEPS) at the end of the step */
+    uint8 Brightness;
+    /* Member contains TRUE to fade linearly from the previous brightness, FALSE to jump and hold */
+    boolean Fade;
+    /* Member contains the step duration in milli-seconds (not 0) */
+    uint16 Time;
+} Led_PatternStepType;
+
+/* Structure for one LED pattern, a const table of steps */
+typedef struct
+{
+    /* Member contains the steps of the pattern */
+    const Led_PatternStepType * Steps;
+    /* Member contains the number of steps */
+    uint8 NumberOfSteps;
+    /* Member contains TRUE to restart at the first step after the last one, else the last brightness is kept */
+    boolean Repeat;
+} Led_PatternType;
+
+/* Predefined patterns */
+extern const Led_PatternType Led_BlinkPattern;
+extern const Led_PatternType Led_BreathePattern;
+extern const Led_PatternType Led_HeartbeatPattern;
+
+/* Description: Start the LED engine with all the engine LEDs OFF, called once after Dio_Init */
+void Led_Init(void);
+
+/* Description: Set the brightness of an engine LED (0 --> LED_PWM_STEPS), its pattern is stopped */
+void Led_SetBrightness(uint8 LedId, uint8 Brightness);
+
+/* Description: Start a pattern on an engine LED, the first step starts from the current brightness,
+ *              a pattern without steps or with a step of 0 milli-seconds is ignored */
+void Led_StartPattern(uint8 LedId, const Led_PatternType * PatternPtr);
+
+/*
+ * Description: This function is called every 40ms by Os Task, it advances the patterns and prepares the PWM
+ *              slot levels of the new brightness values. The PWM timer is stopped while all the engine LEDs
+ *              are fully OFF or ON.
+ */
+void Led_MainFunction(void);
+#endif
+
 #endif /* LED_H */
@@ -22,4 +22,32 @@
 /* Set the LED Pin Number */
 #define LED_PIN_NUM DioConf_LED1_CHANNEL_NUM
 
+/*
+ * Pre-compile option for the LED engine: the brightness of each engine LED is set by a software PWM
+ * refreshed from the Timer3A interrupt, and can follow a blink, breathe or sequence pattern.
+ * LED1 keeps the simple ON/OFF/Toggle APIs above.
+ */
+#define LED_ENGINE_API                       (STD_ON)
+
+/* Number of the engine LEDs */
+#define LED_ENGINE_LEDS                      (2U)
+
+/* LED Index in the engine LEDs table, used as the LedId of the engine APIs */
+#define LedConf_BLUE_LED_ID                  (uint8)0x00
+#define LedConf_GREEN_LED_ID                 (uint8)0x01
+
+/* List of the engine LEDs used to generate the LEDs table: LED(Name, Port, Pin) */
+#define LED_ENGINE_LEDS_LIST(LED) \
+    LED(BLUE,  DioConf_LED_BLUE_PORT_NUM,  DioConf_LED_BLUE_CHANNEL_NUM) \
+    LED(GREEN, DioConf_LED_GREEN_PORT_NUM, DioConf_LED_GREEN_CHANNEL_NUM)
+
+/* Brightness levels 0 (OFF) --> LED_PWM_STEPS (ON), one PWM slot per level (up to 255) */
+#define LED_PWM_STEPS                        (32U)
+
+/* PWM frames per second, fast enough to avoid flicker. The Timer3A interrupt rate is LED_PWM_STEPS times higher */
+#define LED_PWM_FRAME_RATE_HZ                (200U)
+
+/* Period of Led_MainFunction (Led_Task), the time step of the patterns */
+#define LED_ENGINE_PERIOD_MS                 (40U)
+
 #endif /* LED_CFG_H_ */
@@ -9,11 +9,138 @@
  * Author: Mohamed Tarek
  ******************************************************************************/
 
+#include "Mcu.h"
+#include "Common_Macros.h"
+#include "Gpt.h"
 #include "tm4c123gh6pm_registers.h"
 
+/* Wait For Interrupt ... This Macro stops the core clock until an interrupt is pending (even if masked by PRIMASK) */
+#define Wait_For_Interrupt()           __asm(" WFI ")
+
+/* Auto Clock Gating bit in RCC register ... the SCGCx/DCGCx registers are used in Sleep/Deep-Sleep modes */
+#define MCU_RCC_ACG_BIT_POS            27
+
+/* SLEEPDEEP bit in the System Control register ... the WFI enters Deep-Sleep instead of Sleep
+ * The System Control Block is not in a bit-band region, so this bit is updated with a read-modify-write */
+#define MCU_SYSCTRL_SLEEPDEEP_BIT_POS  2
+
+/* DSLPCLKCFG register fields positions */
+#define MCU_DSLPCLKCFG_DSOSCSRC_POS    4
+#define MCU_DSLPCLKCFG_DSDIVORIDE_POS  23
+
+/* Accumulated residency of each mode in system clock counts */
+STATIC uint64 Mcu_ModeResidency[MCU_NUMBER_OF_MODES] = {0};
+
+/* Time stamp captured at the last wake-up, used to account the Run mode residency */
+STATIC uint32 Mcu_WakeUpTimeStamp = 0;
+
 void Mcu_Init(void)
 {
     /* Enable clock for All PORTs and wait for clock to start */
     SYSCTL_RCGCGPIO_REG |= 0x3F;
     while(!(SYSCTL_PRGPIO_REG & 0x3F));
+
+    /* Select the AHB or APB aperture of each GPIO Port before any access by the Port and Dio drivers */
+    SYSCTL_GPIOHBCTL_REG = MCU_GPIO_AHB_PORTS;
+
+    /* Enable the Auto Clock Gating to use the SCGCx/DCGCx registers in Sleep/Deep-Sleep modes */
+    BITBAND_SET_BIT(SYSCTL_RCC_REG,MCU_RCC_ACG_BIT_POS);
+
+    /* Start accounting the Run mode residency from now, the Gpt time base is already running */
+    Mcu_WakeUpTimeStamp = Gpt_GetTimeStamp();
+}
+
+/************************************************************************************
+* Service Name: Mcu_SetMode
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): McuMode - Mode to be entered
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enter the requested power mode:
+*              - MCU_MODE_RUN returns immediately
+*              - MCU_MODE_SLEEP/MCU_MODE_DEEP_SLEEP program the clock gating and wait
+*                for an interrupt, the function returns in Run mode after the wake-up
+*              Must be called with the interrupts disabled (PRIMASK set) so a wake-up
+*              event can not be lost between the decision to sleep and the WFI.
+************************************************************************************/
+void Mcu_SetMode(Mcu_ModeType McuMode)
+{
+    uint32 sleep_start;
+    uint32 sleep_end;
+
+    /*
+     * The residencies are measured with the free running Gpt time base instead of the SysTick down counter,
+     * so a Run stretch or a sleep spanning several Os ticks is fully accounted (up to one 32-bit wrap).
+     */
+
+    if((MCU_MODE_SLEEP == McuMode) || (MCU_MODE_DEEP_SLEEP == McuMode))
+    {
+        sleep_start = Gpt_GetTimeStamp();
+
+        /* Account the Run mode residency since the last wake-up */
+        Mcu_ModeResidency[MCU_MODE_RUN] += (uint32)(sleep_start - Mcu_WakeUpTimeStamp);
+
+        if(MCU_MODE_DEEP_SLEEP == McuMode)
+        {
+            /* Keep only the configured peripherals clocked and select the Deep-Sleep clock source */
+            SYSCTL_DCGCGPIO_REG   = MCU_DEEP_SLEEP_GPIO_CLOCK_GATING;
+            SYSCTL_DCGCTIMER_REG  = MCU_DEEP_SLEEP_TIMER_CLOCK_GATING;
+            SYSCTL_DCGCDMA_REG    = MCU_DEEP_SLEEP_DMA_CLOCK_GATING;
+            SYSCTL_DCGCPWM_REG    = MCU_DEEP_SLEEP_PWM_CLOCK_GATING;
+            SYSCTL_DSLPCLKCFG_REG = (MCU_DEEP_SLEEP_CLOCK_DIVIDER << MCU_DSLPCLKCFG_DSDIVORIDE_POS)
+                                  | (MCU_DEEP_SLEEP_CLOCK_SOURCE << MCU_DSLPCLKCFG_DSOSCSRC_POS);
+            SET_BIT(NVIC_SYSTEM_SYSCTRL,MCU_SYSCTRL_SLEEPDEEP_BIT_POS);
+        }
+        else
+        {
+            /* Keep only the configured peripherals clocked */
+            SYSCTL_SCGCGPIO_REG   = MCU_SLEEP_GPIO_CLOCK_GATING;
+            SYSCTL_SCGCTIMER_REG  = MCU_SLEEP_TIMER_CLOCK_GATING;
+            SYSCTL_SCGCDMA_REG    = MCU_SLEEP_DMA_CLOCK_GATING;
+            SYSCTL_SCGCPWM_REG    = MCU_SLEEP_PWM_CLOCK_GATING;
+            CLEAR_BIT(NVIC_SYSTEM_SYSCTRL,MCU_SYSCTRL_SLEEPDEEP_BIT_POS);
+        }
+
+        /* The core stops here until the wake-up interrupt is pending */
+        Wait_For_Interrupt();
+
+        /* Back in Run mode ... the next WFI shall not enter Deep-Sleep unless requested */
+        CLEAR_BIT(NVIC_SYSTEM_SYSCTRL,MCU_SYSCTRL_SLEEPDEEP_BIT_POS);
+
+        sleep_end = Gpt_GetTimeStamp();
+        Mcu_ModeResidency[McuMode] += (uint32)(sleep_end - sleep_start);
+        Mcu_WakeUpTimeStamp = sleep_end;
+    }
+    else
+    {
+        /* No Action Required ... already in Run mode */
+    }
+}
+
+/************************************************************************************
+* Service Name: Mcu_GetModeResidency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): McuMode - Mode to get its residency
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Time spent in this mode in system clock counts
+* Description: Function to return the accumulated residency of a mode.
+*              The Run mode residency is accounted from the wake-up until the next sleep.
+************************************************************************************/
+uint64 Mcu_GetModeResidency(Mcu_ModeType McuMode)
+{
+    uint64 residency = 0;
+
+    if(McuMode < MCU_NUMBER_OF_MODES)
+    {
+        residency = Mcu_ModeResidency[McuMode];
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    return residency;
 }
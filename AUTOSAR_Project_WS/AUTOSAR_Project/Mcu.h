@@ -15,6 +15,59 @@
 
 #include "Std_Types.h"
 
+/* Mcu Pre-Compile Configuration Header file */
+#include "Mcu_Cfg.h"
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Mcu_ModeType used by the Mcu_SetMode API */
+typedef uint8 Mcu_ModeType;
+
+/* Mcu Modes */
+#define MCU_MODE_RUN                   (Mcu_ModeType)0x00
+#define MCU_MODE_SLEEP                 (Mcu_ModeType)0x01
+#define MCU_MODE_DEEP_SLEEP            (Mcu_ModeType)0x02
+
+/* Number of the supported Mcu Modes */
+#define MCU_NUMBER_OF_MODES            (3U)
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function to initialize the Mcu, called after Gpt_StartTimeBase as the modes residency uses the time stamp base */
 void Mcu_Init(void);
 
+/************************************************************************************
+* Service Name: Mcu_SetMode
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): McuMode - Mode to be entered
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enter the requested power mode:
+*              - MCU_MODE_RUN returns immediately
+*              - MCU_MODE_SLEEP/MCU_MODE_DEEP_SLEEP program the clock gating and wait
+*                for an interrupt, the function returns in Run mode after the wake-up
+*              Must be called with the interrupts disabled (PRIMASK set) so a wake-up
+*              event can not be lost between the decision to sleep and the WFI.
+************************************************************************************/
+void Mcu_SetMode(Mcu_ModeType McuMode);
+
+/************************************************************************************
+* Service Name: Mcu_GetModeResidency
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): McuMode - Mode to get its residency
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: uint64 - Time spent in this mode in system clock counts
+* Description: Function to return the accumulated residency of a mode.
+*              The Run mode residency is accounted from the wake-up until the next sleep.
+************************************************************************************/
+uint64 Mcu_GetModeResidency(Mcu_ModeType McuMode);
+
 #endif /* MCU_H_ */
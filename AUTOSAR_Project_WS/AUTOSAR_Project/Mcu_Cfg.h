@@ -0,0 +1,63 @@
+ /******************************************************************************
+ *
+ * Module: Mcu
+ *
+ * File Name: Mcu_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Mcu Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef MCU_CFG_H_
+#define MCU_CFG_H_
+
+/*
+ * GPIO Ports accessed through the AHB aperture (bit0 --> PORTA ... bit5 --> PORTF), the others use the
+ * legacy APB aperture. The AHB aperture has a single cycle access instead of the APB bus bridge wait states.
+ * Written in GPIOHBCTL by Mcu_Init, the Port and Dio drivers use the base addresses of the selected aperture.
+ */
+#define MCU_GPIO_AHB_PORTS                     (0x3FU)
+
+/* System clock frequency in Run mode (PIOSC 16Mhz, no PLL) */
+#define MCU_RUN_CLOCK_FREQ_HZ                  (16000000U)
+
+/*
+ * Deep-Sleep clock source written in DSLPCLKCFG.DSOSCSRC
+ * 0x0 --> MOSC, 0x1 --> PIOSC, 0x3 --> LFIOSC, 0x7 --> 32.768KHz Hibernate oscillator
+ */
+#define MCU_DEEP_SLEEP_CLOCK_SOURCE            (0x1U)
+
+/* Deep-Sleep clock divider written in DSLPCLKCFG.DSDIVORIDE (0 means divide by 1) */
+#define MCU_DEEP_SLEEP_CLOCK_DIVIDER           (0x0U)
+
+/* System clock frequency in Deep-Sleep mode with the above source and divider */
+#define MCU_DEEP_SLEEP_CLOCK_FREQ_HZ           (16000000U)
+
+/*
+ * GPIO Ports clocked in Sleep and Deep-Sleep modes (bit0 --> PORTA ... bit5 --> PORTF)
+ * PORTF is kept clocked because it holds the LED output and the SW1 input, PORTA and PORTB because the uDMA
+ * refreshes the Display digits and segments while the CPU sleeps.
+ * Dio_WriteSequence only accepts the groups on the ports clocked in both modes.
+ */
+#define MCU_SLEEP_GPIO_CLOCK_GATING            (0x23U)
+#define MCU_DEEP_SLEEP_GPIO_CLOCK_GATING       (0x23U)
+
+/*
+ * 16/32-bit Timers clocked in Sleep and Deep-Sleep modes (bit0 --> Timer0 ... bit5 --> Timer5)
+ * Timer0 is kept clocked because it is the Gpt time stamp base, Timer1 because it paces the Dio sequences,
+ * Timer2 because it times the SW1 debounce lockout, Timer3 because it drives the Led software PWM and
+ * Timer4 because it paces the Display refresh.
+ */
+#define MCU_SLEEP_TIMER_CLOCK_GATING           (0x1FU)
+#define MCU_DEEP_SLEEP_TIMER_CLOCK_GATING      (0x1FU)
+
+/* uDMA clocked in Sleep and Deep-Sleep modes (0x1), a Dio sequence and the Display refresh keep running while the CPU sleeps */
+#define MCU_SLEEP_DMA_CLOCK_GATING             (0x01U)
+#define MCU_DEEP_SLEEP_DMA_CLOCK_GATING        (0x01U)
+
+/* PWM modules clocked in Sleep and Deep-Sleep modes (bit0 --> PWM0, bit1 --> PWM1), the Pwm channels keep their waveforms */
+#define MCU_SLEEP_PWM_CLOCK_GATING             (0x03U)
+#define MCU_DEEP_SLEEP_PWM_CLOCK_GATING        (0x03U)
+
+#endif /* MCU_CFG_H_ */
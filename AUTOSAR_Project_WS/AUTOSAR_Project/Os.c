@@ -14,6 +14,10 @@
 #include "Button.h"
 #include "Led.h"
 #include "Gpt.h"
+#include "Mcu.h"
+#include "Irq.h"
+#include "Dio.h"
+#include "Common_Macros.h"
 
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
@@ -27,15 +31,37 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
+/* Every configured ISR calling the Os or BSW services (the SysTick Os_NewTimerTick included) must respect the ceiling */
+#define OS_CHECK_ISR_CEILING(NAME,OS_ISR) \
+    STATIC_ASSERT((STD_OFF == (OS_ISR)) || (IrqConf_##NAME##_PRIORITY >= OS_ISR_CEILING_PRIORITY), Os_##NAME##_AboveIsrCeiling);
+
+IRQ_CONFIGURED_SOURCES_LIST(OS_CHECK_ISR_CEILING)
+
+/*
+ * The lowest Mcu mode used while idle. The SysTick is the only wake-up source and it counts the system clock,
+ * so the Deep-Sleep mode is only used if its clock keeps the SysTick counting at the OS_BASE_TIME rate.
+ */
+#if (MCU_DEEP_SLEEP_CLOCK_FREQ_HZ == MCU_RUN_CLOCK_FREQ_HZ)
+#define OS_IDLE_MCU_MODE       MCU_MODE_DEEP_SLEEP
+#else
+#define OS_IDLE_MCU_MODE       MCU_MODE_SLEEP
+#endif
+
 /* Global variable store the Os Time */
 static uint8 g_Time_Tick_Count = 0;
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* Global variable to indicate the the timer has a new tick, accessed through its bit-band alias (set in the ISR) */
+static volatile uint8 g_New_Time_Tick_Flag = 0;
+
+/* Bit of g_New_Time_Tick_Flag that indicates a new timer tick */
+#define OS_NEW_TICK_FLAG_BIT   0
 
 /*********************************************************************************************/
 void Os_start(void)
 {
+    /* Relocate the vector table to SRAM and apply the interrupts priorities before installing any ISR */
+    Irq_Init(&Irq_Configuration);
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
     
@@ -56,49 +82,79 @@ void Os_start(void)
 }
 
 /*********************************************************************************************/
-void Os_NewTimerTick(void)
+RAM_FUNC void Os_NewTimerTick(void)
 {
     /* Increment the Os time by OS_BASE_TIME */
     g_Time_Tick_Count   += OS_BASE_TIME;
 
     /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+    BITBAND_SET_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT);
+}
+
+/*********************************************************************************************/
+void Os_IdleHook(void)
+{
+    /* Sleep until the next interrupt ... the Mcu returns in Run mode after the wake-up */
+    Mcu_SetMode(OS_IDLE_MCU_MODE);
 }
 
 /*********************************************************************************************/
-void Os_Scheduler(void)
+RAM_FUNC void Os_Scheduler(void)
 {
     while(1)
     {
+	/*
+	 * Check the flag with the interrupts disabled, a SysTick interrupt between the check and the sleep
+	 * stays pending and wakes the Mcu immediately instead of being lost until the next tick
+	 */
+	Disable_Exceptions();
+	if(BITBAND_GET_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT) == 0)
+	{
+	    Os_IdleHook();
+	}
+	Enable_Exceptions();
+
 	/* Code is only executed in case there is a new timer tick */
-	if(g_New_Time_Tick_Flag == 1)
+	if(BITBAND_GET_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT) == 1)
 	{
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+	    /* Sample all the inputs once, the tasks of this tick see the same levels */
+	    Dio_LatchImage();
+#endif
+#if (DIO_EDGE_NOTIFICATION_API == STD_ON)
+	    /* Refill the edge events budget of the Dio channels once per tick */
+	    Dio_EdgeMainFunction();
+#endif
 	    switch(g_Time_Tick_Count)
             {
 		case 20:
 		case 100:
 			    Button_Task();
-			    g_New_Time_Tick_Flag = 0;
+			    BITBAND_CLEAR_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT);
 			    break;
 		case 40:
 		case 80:
 			    Button_Task();
 			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
+			    BITBAND_CLEAR_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT);
 			    break;
 		case 60:
 			    Button_Task();
 			    App_Task();
-			    g_New_Time_Tick_Flag = 0;
+			    BITBAND_CLEAR_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT);
 			    break;
 		case 120:
 			    Button_Task();
 			    App_Task();
 			    Led_Task();
-			    g_New_Time_Tick_Flag = 0;
+			    BITBAND_CLEAR_BIT(g_New_Time_Tick_Flag,OS_NEW_TICK_FLAG_BIT);
 			    g_Time_Tick_Count = 0;
 			    break;
             }
+#if (DIO_PROCESS_IMAGE_API == STD_ON)
+	    /* Write all the outputs changed by the tasks of this tick once */
+	    Dio_FlushImage();
+#endif
 	}
     }
 
@@ -17,18 +17,32 @@
 /* Timer counting time in ms */
 #define OS_BASE_TIME 20
 
+/*
+ * Os ISR ceiling: the highest interrupt priority (lowest value) allowed for the ISRs that call the Os or BSW services.
+ * The priorities above the ceiling (e.g. priority 0) are reserved for the latency critical sources, which shall not
+ * call those services. The Os critical sections mask all the interrupts with PRIMASK (the idle WFI needs it to wake up
+ * on a masked interrupt), so the ceiling is not a BASEPRI lock level: it only partitions the priorities, checked at
+ * compile time against every source of the Irq configuration marked as an Os ISR.
+ */
+#define OS_ISR_CEILING_PRIORITY      (1U)
+
 /* Description: 
  * Function responsible for:
- * 1. Enable Interrupts
- * 2. Start the Os timer
- * 3. Execute the Init Task
- * 4. Start the Scheduler to run the tasks
+ * 1. Initialize the Irq Driver (RAM vector table)
+ * 2. Enable Interrupts
+ * 3. Start the Os timer
+ * 4. Execute the Init Task
+ * 5. Start the Scheduler to run the tasks
  */
 void Os_start(void);
 
 /* Description: The Engine of the Os Scheduler used for switch between different tasks */
 void Os_Scheduler(void);
 
+/* Description: Function called by the Os Scheduler when there is no task to run, it puts the Mcu in the lowest
+ *              power mode compatible with the next wake-up source (the Os timer) */
+void Os_IdleHook(void);
+
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
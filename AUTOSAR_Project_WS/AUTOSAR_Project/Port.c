@@ -13,6 +13,10 @@
 #include "Port_Regs.h"
 #include "Det.h"
 
+/* The services below are the runtime checked ones, not the routing macros of Port.h for constant Pin IDs */
+#undef Port_SetPinDirection
+#undef Port_SetPinMode
+
 /* AUTOSAR Version checking between Det and Dio Modules */
 #if ((DET_AR_MAJOR_VERSION != PORT_AR_RELEASE_MAJOR_VERSION)\
         || (DET_AR_MINOR_VERSION != PORT_AR_RELEASE_MINOR_VERSION)\
@@ -24,6 +28,12 @@ STATIC Port_Status PORT_Status = PORT_NOT_INITIALIZED;
 
 STATIC const Port_ConfigChannel *Port_PortChannels = NULL_PTR;
 
+/* Open drain output pins of each port indexed by Port_ID */
+STATIC const uint8 Port_OpenDrainPins[] = {
+        PORT_PORTA_OPEN_DRAIN_PINS, PORT_PORTB_OPEN_DRAIN_PINS, PORT_PORTC_OPEN_DRAIN_PINS,
+        PORT_PORTD_OPEN_DRAIN_PINS, PORT_PORTE_OPEN_DRAIN_PINS, PORT_PORTF_OPEN_DRAIN_PINS
+};
+
 /************************************************************************************
  * Service Name:     Port_Init
  * Sync/Async:       Synchronous
@@ -46,6 +56,8 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
 
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
 
+    boolean error = FALSE;
+
     /************************************************************************************
      *                          [1] DEVELOPMENT EEROR CHECKING
      * [A]Checking the development error: PORT_E_PARAM_CONFIG
@@ -59,6 +71,7 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID,
         PORT_E_PARAM_CONFIG);
+        error = TRUE;
     }
     else
 #endif
@@ -73,10 +86,10 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
 
     /************************************************************************************
      *                          [2] LOOPING TO ALL CHANNELS
-     * [A] LOOPING TO ALL CHANNELS to assign the Post-build configurations
+     * [A] LOOPING TO ALL CHANNELS to assign the Post-build configurations, skipped without a configuration
      ***********************************************************************************/
 
-    for (pinIndex = PORTA_PA0; pinIndex < PORT_NUMBER_OF_PORT_PINS; pinIndex++)
+    for (pinIndex = PORTA_PA0; (FALSE == error) && (pinIndex < PORT_NUMBER_OF_PORT_PINS); pinIndex++)
     {
 
         /*************************** START OF LOOPING TO ALL CHANNELS **********************/
@@ -122,7 +135,7 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
             *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
                     + PORT_LOCK_REG_OFFSET) = UNLOCK_VALUE;
             /* Set the corresponding bit in GPIOCR register to allow changes on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET),
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_COMMIT_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
         }
         else if ((Port_PortChannels[pinIndex].port_num == PORT_C)
@@ -144,19 +157,33 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
         if (Port_PortChannels[pinIndex].direction == OUTPUT)
         {
             /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
 
+            if (Port_OpenDrainPins[Port_PortChannels[pinIndex].port_num] & (1U << Port_PortChannels[pinIndex].pin_num))
+            {
+                /* Set the corresponding bit in the GPIOODR register to configure it as open drain pin */
+                BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET),
+                        Port_PortChannels[pinIndex].pin_num);
+            }
+            else
+            {
+                /* Clear the corresponding bit in the GPIOODR register to configure it as push-pull pin */
+                BITBAND_CLEAR_BIT(
+                        *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_OPEN_DRAIN_REG_OFFSET),
+                        Port_PortChannels[pinIndex].pin_num);
+            }
+
             if (Port_PortChannels[pinIndex].initial_value == STD_HIGH)
             {
                 /* Set the corresponding bit in the GPIODATA register to provide initial value 1 */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET),
+                BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
             }
             else
             {
                 /* Clear the corresponding bit in the GPIODATA register to provide initial value 0 */
-                CLEAR_BIT(
+                BITBAND_CLEAR_BIT(
                         *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DATA_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
             }
@@ -164,30 +191,30 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
         else if (Port_PortChannels[pinIndex].direction == INPUT)
         {
             /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-            CLEAR_BIT(
+            BITBAND_CLEAR_BIT(
                     *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
 
             if (Port_PortChannels[pinIndex].resistor == PULL_UP)
             {
                 /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET),
+                BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
             }
             else if (Port_PortChannels[pinIndex].resistor == PULL_DOWN)
             {
                 /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET),
+                BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
             }
             else
             {
                 /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                CLEAR_BIT(
+                BITBAND_CLEAR_BIT(
                         *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_UP_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
                 /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-                CLEAR_BIT(
+                BITBAND_CLEAR_BIT(
                         *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_PULL_DOWN_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num);
             }
@@ -209,13 +236,13 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
             /************************** ENABLE THE ANALOG FUNCTIONALITY **************************************
              * Set the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
              *************************************************************************************************/
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
 
             /************************** DISABLE THE DIGITAL FUNCTIONALITY *************************************
              *  Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
              ***************************************************************************************************/
-            CLEAR_BIT(
+            BITBAND_CLEAR_BIT(
                     *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
         }
@@ -224,14 +251,14 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
             /************************** DISABLE THE ANALOG FUNCTIONALITY **************************************
              *Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
              ***************************************************************************************************/
-            CLEAR_BIT(
+            BITBAND_CLEAR_BIT(
                     *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
 
             /************************** ENABLE THE DIGITAL FUNCTIONALITY *************************************
              * Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
              **************************************************************************************************/
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
         }
 
@@ -245,7 +272,7 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
         {
             /************************************* DISABLE ***************************************/
             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(
+            BITBAND_CLEAR_BIT(
                     *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
         }
@@ -253,7 +280,7 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
         {
             /************************************* ENABLE ***************************************/
             /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
                     Port_PortChannels[pinIndex].pin_num);
             /************************************************************************************
              * [B] Assigning the value of PCMx register based on the mode of the pin configured in PB structure
@@ -312,7 +339,7 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
                 /****************************************** PWM *************************************/
             case PORT_PIN_MODE_PWM:
 
-                /* NOTE: The SW only support the Motion Control Module 0 */
+                /* Motion Control Module 0 outputs */
 
                 *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
                         + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_4
@@ -320,6 +347,17 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
 
                 break;
 
+                /****************************************** PWM1 ************************************/
+            case PORT_PIN_MODE_PWM1:
+
+                /* Motion Control Module 1 outputs */
+
+                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_5
+                        << (Port_PortChannels[pinIndex].pin_num * SHFITING_VALUE_FOUR));
+
+                break;
+
                 /****************************************** SSI *************************************/
             case PORT_PIN_MODE_SSI:
 
@@ -384,48 +422,39 @@ void Port_Init(const Port_ConfigType *ConfigPtr)
  * Parameters (inout): None
  * Parameters (out):   None
  * Return value:       None
- * Description:        Sets the port pin direction.
+ * Description:        Sets the port pin direction, the GPIODIR bit is left unchanged after an error.
  ************************************************************************************/
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 {
 
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
-    /* Check if the Driver is initialized before using this function */
-    if (PORT_NOT_INITIALIZED == PORT_Status)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
-        PORT_SET_PIN_DIRECTION_SID,
-                        PORT_E_UNINIT);
-
-    }
-    else
-    {
-        /* No Action Required */
-    }
-
     /* Check if incorrect Port Pin ID passed before using this function */
     if (Pin >= PORT_NUMBER_OF_PORT_PINS)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
         PORT_SET_PIN_DIRECTION_SID,
                         PORT_E_PARAM_PIN);
-
+        error = TRUE;
     }
-    else
+    /* Check if the Driver is initialized before using this function */
+    else if (PORT_NOT_INITIALIZED == PORT_Status)
     {
-        /* No Action Required */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
+        PORT_SET_PIN_DIRECTION_SID,
+                        PORT_E_UNINIT);
+        error = TRUE;
     }
-
     /* Check if Port Pin not configured as changeable before using this function */
-    if (Port_PortChannels[Pin].pin_direction_change == STD_OFF)
+    else if (Port_PortChannels[Pin].pin_direction_change == STD_OFF)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
         PORT_SET_PIN_DIRECTION_SID,
                         PORT_E_DIRECTION_UNCHANGEABLE);
-
+        error = TRUE;
     }
     else
     {
@@ -434,49 +463,57 @@ void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
 
 #endif
 
-    switch (Port_PortChannels[Pin].port_num)
+    /* In-case there are no errors */
+    if (FALSE == error)
     {
-    case PORT_A:
-        /* PORTA Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS;
-        break;
-    case PORT_B:
-        /* PORTB Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS;
-        break;
-    case PORT_C:
-        /* PORTC Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS;
-        break;
-    case PORT_D:
-        /* PORTD Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS;
-        break;
-    case PORT_E:
-        /* PORTE Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS;
-        break;
-    case PORT_F:
-        /* PORTF Base Address */
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS;
-        break;
-    }
+        switch (Port_PortChannels[Pin].port_num)
+        {
+        case PORT_A:
+            /* PORTA Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS;
+            break;
+        case PORT_B:
+            /* PORTB Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS;
+            break;
+        case PORT_C:
+            /* PORTC Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS;
+            break;
+        case PORT_D:
+            /* PORTD Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS;
+            break;
+        case PORT_E:
+            /* PORTE Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS;
+            break;
+        case PORT_F:
+            /* PORTF Base Address */
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS;
+            break;
+        }
 
-    if (Port_PortChannels[Pin].direction == OUTPUT)
-    {
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
+        if (Direction == OUTPUT)
+        {
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
 
-    }
-    else if (Port_PortChannels[Pin].direction == INPUT)
-    {
-        CLEAR_BIT(
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+        }
+        else if (Direction == INPUT)
+        {
+            BITBAND_CLEAR_BIT(
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
+        }
+        else
+        {
+            /* Do Nothing */
+        }
     }
     else
     {
-        /* Do Nothing */
+        /* No Action Required */
     }
 }
 #endif
@@ -496,6 +533,7 @@ void Port_RefreshPortDirection(void)
 
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
     uint8 pinIndex = PORTA_PA0;
+    boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -505,7 +543,7 @@ void Port_RefreshPortDirection(void)
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID,
         PORT_REFRESH_PORT_DIRECTION_SID,
                         PORT_E_UNINIT);
-
+        error = TRUE;
     }
     else
     {
@@ -514,7 +552,8 @@ void Port_RefreshPortDirection(void)
 
 #endif
 
-    for (pinIndex = PORTA_PA0; pinIndex <= PORT_NUMBER_OF_PORT_PINS; pinIndex++)
+    /* In-case there are no errors, the configured pins are refreshed */
+    for (pinIndex = PORTA_PA0; (FALSE == error) && (pinIndex < PORT_NUMBER_OF_PORT_PINS); pinIndex++)
     {
 
         switch (Port_PortChannels[pinIndex].port_num)
@@ -550,13 +589,13 @@ void Port_RefreshPortDirection(void)
         {
             if (OUTPUT == Port_PortChannels[pinIndex].direction)
             {
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
+                BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num); /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
 
             }
             else if (INPUT == Port_PortChannels[pinIndex].direction)
             {
-                CLEAR_BIT(
+                BITBAND_CLEAR_BIT(
                         *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIR_REG_OFFSET),
                         Port_PortChannels[pinIndex].pin_num); /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
 
@@ -628,43 +667,42 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
  * Return value:       None
  * Description:        This function sets the port pin mode:
  *                     - It modifies the mode of the specified port pin during runtime.
+ *                     - The pin registers are left unchanged after an error.
  ************************************************************************************/
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 {
     volatile uint32 *PortGpio_Ptr = NULL_PTR; /* point to the required Port Registers base address */
+    boolean error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
-    /* Check if the Driver is initialized before using this function */
-    if (PORT_NOT_INITIALIZED == PORT_Status)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
-        PORT_E_UNINIT);
-
-    }
-    else
-    {
-        /* No Action Required */
-    }
-
     /* Check if incorrect Port Pin ID passed before using this function */
     if (Pin >= PORT_NUMBER_OF_PORT_PINS)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
         PORT_E_PARAM_PIN);
-
+        error = TRUE;
     }
-    else
+    /* Check if the Driver is initialized before using this function */
+    else if (PORT_NOT_INITIALIZED == PORT_Status)
     {
-        /* No Action Required */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_UNINIT);
+        error = TRUE;
     }
-
-    /* Check if Port Pin not configured as changeable before using this function */
-    if (Port_PortChannels[Pin].pin_direction_change == STD_OFF)
+    /* Check if the requested mode is one of the supported modes */
+    else if (Mode > PORT_PIN_MODE_PWM1)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
+        PORT_E_PARAM_INVALID_MODE);
+        error = TRUE;
+    }
+    /* Check if Port Pin not configured as mode changeable before using this function */
+    else if (Port_PortChannels[Pin].pin_mode_change == PIN_MODE_CHANGEABLE_OFF)
     {
         Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID,
         PORT_E_MODE_UNCHANGEABLE);
-
+        error = TRUE;
     }
     else
     {
@@ -673,204 +711,227 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
 
 #endif
 
-    switch (Port_PortChannels[Pin].port_num)
+    /* In-case there are no errors */
+    if (FALSE == error)
     {
-    case 0:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
-        break;
-    case 1:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
-        break;
-    case 2:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
-        break;
-    case 3:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
-        break;
-    case 4:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
-        break;
-    case 5:
-        PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
-        break;
-    }
+        switch (Port_PortChannels[Pin].port_num)
+        {
+        case 0:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTA_BASE_ADDRESS; /* PORTA Base Address */
+            break;
+        case 1:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTB_BASE_ADDRESS; /* PORTB Base Address */
+            break;
+        case 2:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTC_BASE_ADDRESS; /* PORTC Base Address */
+            break;
+        case 3:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTD_BASE_ADDRESS; /* PORTD Base Address */
+            break;
+        case 4:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTE_BASE_ADDRESS; /* PORTE Base Address */
+            break;
+        case 5:
+            PortGpio_Ptr = (volatile uint32*) GPIO_PORTF_BASE_ADDRESS; /* PORTF Base Address */
+            break;
+        }
 
-    if ((Port_PortChannels[Pin].port_num == PORT_C)
-            && (Port_PortChannels[Pin].pin_num <= PIN3_PIN_NUM )) /* PC0 to PC3 */
-    {
-        /* Do Nothing ...  this is the JTAG pins */
+        if ((Port_PortChannels[Pin].port_num == PORT_C)
+                && (Port_PortChannels[Pin].pin_num <= PIN3_PIN_NUM )) /* PC0 to PC3 */
+        {
+            /* Do Nothing ...  this is the JTAG pins */
 
-    }
+        }
 
-    /************************************************************************************
-     *                      [6] ANALOG AND DIGITAL FUNCTIONALITY OF THE PIN
-     * [A] ENABLE or DISABLE the analog and digital functionality of the pin based on the PB configuration
-     ***********************************************************************************/
+        /************************************************************************************
+         *                      [6] ANALOG AND DIGITAL FUNCTIONALITY OF THE PIN
+         * [A] ENABLE or DISABLE the analog and digital functionality of the pin based on the PB configuration
+         ***********************************************************************************/
 
-    if (PORT_PIN_MODE_ADC == Port_PortChannels[Pin].pin_mode)
-    {
-        /************************************ INCASE OF THE ADC  *****************************************/
-
-        /************************** ENABLE THE ANALOG FUNCTIONALITY **************************************
-         * Set the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
-         *************************************************************************************************/
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
-
-        /************************** DISABLE THE DIGITAL FUNCTIONALITY *************************************
-         *  Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
-         ***************************************************************************************************/
-        CLEAR_BIT(
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
-    }
-    else
-    {
-        /************************** DISABLE THE ANALOG FUNCTIONALITY **************************************
-         *Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
-         ***************************************************************************************************/
-        CLEAR_BIT(
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
-
-        /************************** ENABLE THE DIGITAL FUNCTIONALITY *************************************
-         * Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
-         **************************************************************************************************/
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
-    }
+        if (PORT_PIN_MODE_ADC == Mode)
+        {
+            /************************************ INCASE OF THE ADC  *****************************************/
 
-    /************************************************************************************
-     *          [7] ALTERNATIVE FUNCTIONALITY AND CONTROL REGISTER PCMx OF THE PIN
-     * [A] ENABLE or DISABLE the alternative functionality of the pin based on the PB configuration
-     * [B] IF ENABLE, So Assigning the value of PCMx REGISTER based on the mode of the pin configured in PB structure
-     ***********************************************************************************/
+            /************************** ENABLE THE ANALOG FUNCTIONALITY **************************************
+             * Set the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
+             *************************************************************************************************/
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+
+            /************************** DISABLE THE DIGITAL FUNCTIONALITY *************************************
+             *  Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
+             ***************************************************************************************************/
+            BITBAND_CLEAR_BIT(
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+        }
+        else
+        {
+            /************************** DISABLE THE ANALOG FUNCTIONALITY **************************************
+             *Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin*
+             ***************************************************************************************************/
+            BITBAND_CLEAR_BIT(
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+
+            /************************** ENABLE THE DIGITAL FUNCTIONALITY *************************************
+             * Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin  *
+             **************************************************************************************************/
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+        }
+
+        /* Clear the PMCx field of the pin, the previous mode shall not be combined with the new one */
+        *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                + PORT_CTL_REG_OFFSET) &= ~((uint32)0x0000000F
+                << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-    if (PORT_PIN_MODE_DIO == Port_PortChannels[Pin].pin_mode)
-    {
-        /************************************* DISABLE ***************************************/
-        /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-        CLEAR_BIT(
-                *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
-    }
-    else
-    {
-        /************************************* ENABLE ***************************************/
-        /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
-                Port_PortChannels[Pin].pin_num);
         /************************************************************************************
-         * [B] Assigning the value of PCMx register based on the mode of the pin configured in PB structure
+         *          [7] ALTERNATIVE FUNCTIONALITY AND CONTROL REGISTER PCMx OF THE PIN
+         * [A] ENABLE or DISABLE the alternative functionality of the pin based on the PB configuration
+         * [B] IF ENABLE, So Assigning the value of PCMx REGISTER based on the mode of the pin configured in PB structure
          ***********************************************************************************/
 
-        switch (Port_PortChannels[Pin].pin_mode)
+        if (PORT_PIN_MODE_DIO == Mode)
         {
+            /************************************* DISABLE ***************************************/
+            /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
+            BITBAND_CLEAR_BIT(
+                    *(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+        }
+        else
+        {
+            /************************************* ENABLE ***************************************/
+            /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
+            BITBAND_SET_BIT(*(volatile uint32 *)((volatile uint8 *)PortGpio_Ptr + PORT_ALT_FUNC_REG_OFFSET),
+                    Port_PortChannels[Pin].pin_num);
+            /************************************************************************************
+             * [B] Assigning the value of PCMx register based on the mode of the pin configured in PB structure
+             ***********************************************************************************/
 
-        /****************************************** CAN *************************************/
-        case PORT_PIN_MODE_CAN:
-
-            if (Port_PortChannels[Pin].port_num == PORT_F
-                    && (Port_PortChannels[Pin].pin_num == PIN0_PIN_NUM
-                            || Port_PortChannels[Pin].pin_num == PIN3_PIN_NUM ))
+            switch (Mode)
             {
-                /************************************************************************
-                 *                         with PF0 & PF3 >>> PCMx = 3
-                 ***********************************************************************/
+
+            /****************************************** CAN *************************************/
+            case PORT_PIN_MODE_CAN:
+
+                if (Port_PortChannels[Pin].port_num == PORT_F
+                        && (Port_PortChannels[Pin].pin_num == PIN0_PIN_NUM
+                                || Port_PortChannels[Pin].pin_num == PIN3_PIN_NUM ))
+                {
+                    /************************************************************************
+                     *                         with PF0 & PF3 >>> PCMx = 3
+                     ***********************************************************************/
+
+                    *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                            + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_3
+                            << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+
+                }
+                else
+                {
+                    /************************************************************************
+                     *          with PA0 & PA1 & PB4 & PB5 & PE4 & PE5 >>> PCMx = 8
+                     ***********************************************************************/
+
+                    *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                            + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_8
+                            << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+
+                }
+
+                break;
+                /****************************************** GPT *************************************/
+            case PORT_PIN_MODE_GPT:
 
                 *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_3
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_7
                         << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-            }
-            else
-            {
-                /************************************************************************
-                 *          with PA0 & PA1 & PB4 & PB5 & PE4 & PE5 >>> PCMx = 8
-                 ***********************************************************************/
+                break;
+                /****************************************** I2C *************************************/
+            case PORT_PIN_MODE_I2C:
 
                 *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_8
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_3
                         << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-            }
+                break;
 
-            break;
-            /****************************************** GPT *************************************/
-        case PORT_PIN_MODE_GPT:
+                /****************************************** PWM *************************************/
+            case PORT_PIN_MODE_PWM:
 
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_7
-                    << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                /* Motion Control Module 0 outputs */
 
-            break;
-            /****************************************** I2C *************************************/
-        case PORT_PIN_MODE_I2C:
+                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_4
+                        << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_3
-                    << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                break;
 
-            break;
+                /****************************************** PWM1 ************************************/
+            case PORT_PIN_MODE_PWM1:
 
-            /****************************************** PWM *************************************/
-        case PORT_PIN_MODE_PWM:
+                /* Motion Control Module 1 outputs */
 
-            /* NOTE: The SW only support the Motion Control Module 0 */
+                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_5
+                        << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_4
-                    << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                break;
 
-            break;
+                /****************************************** SSI *************************************/
+            case PORT_PIN_MODE_SSI:
 
-            /****************************************** SSI *************************************/
-        case PORT_PIN_MODE_SSI:
+                if (Port_PortChannels[Pin].port_num
+                        == PORT_D&& Port_PortChannels[Pin].pin_num <=PIN3_PIN_NUM)
+                {
+                    /************************************************************************
+                     *                         with PD0 & PD1 & PD2 & PD3 >>> PCMx = 1
+                     ***********************************************************************/
 
-            if (Port_PortChannels[Pin].port_num
-                    == PORT_D&& Port_PortChannels[Pin].pin_num <=PIN3_PIN_NUM)
-            {
-                /************************************************************************
-                 *                         with PD0 & PD1 & PD2 & PD3 >>> PCMx = 1
-                 ***********************************************************************/
+                    *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                            + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_1
+                            << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_1
-                        << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                }
+                else
+                {
+                    /************************************************************************
+                     *                         with other pins
+                     ***********************************************************************/
+                    *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                            + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_2
+                            << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                }
 
-            }
-            else
-            {
-                /************************************************************************
-                 *                         with other pins
-                 ***********************************************************************/
-                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_2
-                        << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
-            }
+                break;
 
-            break;
+                /****************************************** UART *************************************/
+            case PORT_PIN_MODE_UART:
 
-            /****************************************** UART *************************************/
-        case PORT_PIN_MODE_UART:
+                *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
+                        + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_1
+                        << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
 
-            *(volatile uint32*) ((volatile uint8*) PortGpio_Ptr
-                    + PORT_CTL_REG_OFFSET) |= (PMCx_REGISTER_1
-                    << (Port_PortChannels[Pin].pin_num * SHFITING_VALUE_FOUR));
+                break;
 
-            break;
+            default:
 
-        default:
+                /* Do nothing */
 
-            /* Do nothing */
+                break;
 
-            break;
+                /**************************END OF SWITCH **********************************************/
+            }
 
-            /**************************END OF SWITCH **********************************************/
+            /**************************END OF IF CONDITION **********************************************/
         }
-
-        /**************************END OF IF CONDITION **********************************************/
     }
-
+    else
+    {
+        /* No Action Required */
+    }
 }
 #endif
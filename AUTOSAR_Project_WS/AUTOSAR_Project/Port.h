@@ -96,13 +96,6 @@ typedef enum {
 /*******************************************************************************
  *                              MODULE DEFINITIONS                             *
  *******************************************************************************/
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
@@ -119,6 +112,7 @@ typedef enum {
 #define PMCx_REGISTER_2            		  0x00000002
 #define PMCx_REGISTER_3            		  0x00000003
 #define PMCx_REGISTER_4             	  0x00000004
+#define PMCx_REGISTER_5             	  0x00000005
 #define PMCx_REGISTER_7             	  0x00000007
 #define PMCx_REGISTER_8             	  0x00000008
 
@@ -341,6 +335,14 @@ void Port_Init(const Port_ConfigType* ConfigPtr);
  * Description:        Sets the port pin direction.
  ************************************************************************************/
 void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction );
+
+/*
+ * A compile-time constant Pin ID is checked against PORT_NUMBER_OF_PORT_PINS at compile time, the build fails
+ * for an invalid ID. All the calls then go through the DET checks of Port_SetPinDirection, none of them can be
+ * skipped from outside the driver.
+ */
+#define Port_SetPinDirection(Pin,Direction) \
+    (COMPILE_TIME_CHECK(Pin, PORT_NUMBER_OF_PORT_PINS > (Pin)), Port_SetPinDirection((Pin),(Direction)))
 #endif
 
 
@@ -386,6 +388,10 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 *                     - It modifies the mode of the specified port pin during runtime.
 ************************************************************************************/
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
+
+/* Same compile-time check of a constant Pin ID as Port_SetPinDirection */
+#define Port_SetPinMode(Pin,Mode) \
+    (COMPILE_TIME_CHECK(Pin, PORT_NUMBER_OF_PORT_PINS > (Pin)), Port_SetPinMode((Pin),(Mode)))
 #endif
 
 /* Extern PB structures to be used by Port and other modules */
@@ -54,6 +54,7 @@
 #define PORT_PIN_MODE_SYSCLK    (13U)           /*Port Pin used by System Control & Clocks*/
 #define PORT_PIN_MODE_UART      (14U)           /**Port Pin used by UART*/
 #define PORT_PIN_MODE_USB       (15U)           /**Port Pin used by USB*/
+#define PORT_PIN_MODE_PWM1      (16U)           /**Port Pin used by Motion Control Module 1 PWM (PORT_PIN_MODE_PWM is Module 0)*/
 
  /*******************************************************************************
  *                                PORTA                                         *
@@ -152,8 +153,16 @@
  *                                [CONFIGURED PORT PINS]
  *        NOTE: SIMULATING AS I CONFIGRED PINS FROM AUTOSAR CONFIGURAQTION TOOL
  *        - PORTF-PIN1 for LED
+ *        - PORTF-PIN2 for LED_BLUE
+ *        - PORTF-PIN3 for LED_GREEN
  *        - PORTF-PIN4 for BUTTON
- *        So, I created TWO PortPin Containers
+ *        - PORTE-PIN0 --> PIN3 for the KEYPAD rows
+ *        - PORTC-PIN4 --> PIN7 for the KEYPAD columns
+ *        - PORTE-PIN4, PIN5 for the Motion Control Module 0 PWM outputs M0PWM4, M0PWM5
+ *        - PORTA-PIN6, PIN7 for the Motion Control Module 1 PWM outputs M1PWM2, M1PWM3
+ *        - PORTB-PIN0 --> PIN7 for the DISPLAY segments
+ *        - PORTA-PIN2 --> PIN5 for the DISPLAY digit selects
+ *        So, I created TEN PortPin Containers, the KEYPAD, PWM and DISPLAY containers are shared by the pins of a group
  ************************************************************************************
 | Module Name          | Port                                                |
 | Module Description   | Configuration of the Port module.                   |
@@ -201,6 +210,38 @@
             #define PORT_PIN_LED_PORT_ID                (PORT_F)
             #define PORT_PIN_LED_INTERNAL_RESISTOR      (OFF)
 
+            /************************************************************************************
+            | Container Name       | PortPin_LED_BLUE                                           |
+            | Description Module   | Configuration of the individual port pins.                 |
+            ************************************************************************************/
+
+            #define PORT_PIN_LED_BLUE_DIRECTION              (OUTPUT)               /*Valid Range: input or output*/
+            #define PORT_PIN_LED_BLUE_DIRECTION_CHANGEABLE   (DISABLE)              /*Valid Range: enable or disable*/
+            #define PORT_PIN_LED_BLUE_ID                     (PIN2_PIN_NUM)         /*Valid Range: 0 to 65535*/
+            #define PORT_PIN_LED_BLUE_INTIAL_MODE            (PORT_PIN_MODE_DIO)    /*Valid Range: one of supported modes above */
+            #define PORT_PIN_LED_BLUE_LEVEL_VALUE            (PORT_PIN_LEVEL_LOW)   /*Valid Range: High or Low*/
+            #define PORT_PIN_LED_BLUE_MODE                   (PORT_PIN_MODE_DIO)    /*Valid Range: one of supported modes above */
+            #define PORT_PIN_LED_BLUE_CHANGEABLE             (DISABLE)              /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_LED_BLUE_PORT_ID                (PORT_F)
+            #define PORT_PIN_LED_BLUE_INTERNAL_RESISTOR      (OFF)
+
+            /************************************************************************************
+            | Container Name       | PortPin_LED_GREEN                                          |
+            | Description Module   | Configuration of the individual port pins.                 |
+            ************************************************************************************/
+
+            #define PORT_PIN_LED_GREEN_DIRECTION              (OUTPUT)               /*Valid Range: input or output*/
+            #define PORT_PIN_LED_GREEN_DIRECTION_CHANGEABLE   (DISABLE)              /*Valid Range: enable or disable*/
+            #define PORT_PIN_LED_GREEN_ID                     (PIN3_PIN_NUM)         /*Valid Range: 0 to 65535*/
+            #define PORT_PIN_LED_GREEN_INTIAL_MODE            (PORT_PIN_MODE_DIO)    /*Valid Range: one of supported modes above */
+            #define PORT_PIN_LED_GREEN_LEVEL_VALUE            (PORT_PIN_LEVEL_LOW)   /*Valid Range: High or Low*/
+            #define PORT_PIN_LED_GREEN_MODE                   (PORT_PIN_MODE_DIO)    /*Valid Range: one of supported modes above */
+            #define PORT_PIN_LED_GREEN_CHANGEABLE             (DISABLE)              /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_LED_GREEN_PORT_ID                (PORT_F)
+            #define PORT_PIN_LED_GREEN_INTERNAL_RESISTOR      (OFF)
+
             /************************************************************************************
             | Container Name       | PortPin_BUTTON                                             |
             | Description Module   | Configuration of the individual port pins.                 |
@@ -217,6 +258,110 @@
             #define PORT_PIN_BUTTON_PORT_ID               (PORT_F)
             #define PORT_PIN_BUTTON_INTERNAL_RESISTOR     (PULL_UP)
 
+            /************************************************************************************
+            | Container Name       | PortPin_KEYPAD_ROW                                         |
+            | Description Module   | Configuration of the keypad rows PORTE Pin0 --> Pin3.      |
+            ************************************************************************************/
+
+            #define PORT_PIN_KEYPAD_ROW_DIRECTION             (OUTPUT)              /*Valid Range: input or output*/
+            #define PORT_PIN_KEYPAD_ROW_DIRECTION_CHANGEABLE  (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_KEYPAD_ROW_INTIAL_MODE           (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_KEYPAD_ROW_LEVEL_VALUE           (PORT_PIN_LEVEL_HIGH) /*Valid Range: High or Low*/
+            #define PORT_PIN_KEYPAD_ROW_MODE                  (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_KEYPAD_ROW_CHANGEABLE            (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_KEYPAD_ROW_PORT_ID               (PORT_E)
+            #define PORT_PIN_KEYPAD_ROW_INTERNAL_RESISTOR     (OFF)
+
+            /************************************************************************************
+            | Container Name       | PortPin_KEYPAD_COLUMN                                      |
+            | Description Module   | Configuration of the keypad columns PORTC Pin4 --> Pin7.   |
+            ************************************************************************************/
+
+            #define PORT_PIN_KEYPAD_COLUMN_DIRECTION            (INPUT)               /*Valid Range: input or output*/
+            #define PORT_PIN_KEYPAD_COLUMN_DIRECTION_CHANGEABLE (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_KEYPAD_COLUMN_INTIAL_MODE          (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_KEYPAD_COLUMN_LEVEL_VALUE          (PORT_PIN_LEVEL_LOW)  /*Valid Range: High or Low*/
+            #define PORT_PIN_KEYPAD_COLUMN_MODE                 (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_KEYPAD_COLUMN_CHANGEABLE           (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_KEYPAD_COLUMN_PORT_ID              (PORT_C)
+            #define PORT_PIN_KEYPAD_COLUMN_INTERNAL_RESISTOR    (PULL_UP)
+
+            /************************************************************************************
+            | Container Name       | PortPin_PWM_M0                                             |
+            | Description Module   | Configuration of M0PWM4 (PORTE Pin4) and M0PWM5 (Pin5).    |
+            ************************************************************************************/
+
+            #define PORT_PIN_PWM_M0_DIRECTION                 (OUTPUT)              /*Valid Range: input or output*/
+            #define PORT_PIN_PWM_M0_DIRECTION_CHANGEABLE      (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_PWM_M0_INTIAL_MODE               (PORT_PIN_MODE_PWM)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_PWM_M0_LEVEL_VALUE               (PORT_PIN_LEVEL_LOW)  /*Valid Range: High or Low*/
+            #define PORT_PIN_PWM_M0_MODE                      (PORT_PIN_MODE_PWM)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_PWM_M0_CHANGEABLE                (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_PWM_M0_PORT_ID                   (PORT_E)
+            #define PORT_PIN_PWM_M0_INTERNAL_RESISTOR         (OFF)
+
+            /************************************************************************************
+            | Container Name       | PortPin_PWM_M1                                             |
+            | Description Module   | Configuration of M1PWM2 (PORTA Pin6) and M1PWM3 (Pin7).    |
+            ************************************************************************************/
+
+            #define PORT_PIN_PWM_M1_DIRECTION                 (OUTPUT)              /*Valid Range: input or output*/
+            #define PORT_PIN_PWM_M1_DIRECTION_CHANGEABLE      (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_PWM_M1_INTIAL_MODE               (PORT_PIN_MODE_PWM1)  /*Valid Range: one of supported modes above */
+            #define PORT_PIN_PWM_M1_LEVEL_VALUE               (PORT_PIN_LEVEL_LOW)  /*Valid Range: High or Low*/
+            #define PORT_PIN_PWM_M1_MODE                      (PORT_PIN_MODE_PWM1)  /*Valid Range: one of supported modes above */
+            #define PORT_PIN_PWM_M1_CHANGEABLE                (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_PWM_M1_PORT_ID                   (PORT_A)
+            #define PORT_PIN_PWM_M1_INTERNAL_RESISTOR         (OFF)
+
+            /************************************************************************************
+            | Container Name       | PortPin_DISPLAY_SEGMENT                                    |
+            | Description Module   | Configuration of the display segments PORTB Pin0 --> Pin7. |
+            ************************************************************************************/
+
+            #define PORT_PIN_DISPLAY_SEGMENT_DIRECTION             (OUTPUT)              /*Valid Range: input or output*/
+            #define PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE  (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_DISPLAY_SEGMENT_INTIAL_MODE           (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE           (PORT_PIN_LEVEL_LOW)  /*Valid Range: High or Low*/
+            #define PORT_PIN_DISPLAY_SEGMENT_MODE                  (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE            (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_DISPLAY_SEGMENT_PORT_ID               (PORT_B)
+            #define PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR     (OFF)
+
+            /************************************************************************************
+            | Container Name       | PortPin_DISPLAY_DIGIT                                      |
+            | Description Module   | Configuration of the display digit selects PORTA Pin2 --> Pin5. |
+            ************************************************************************************/
+
+            #define PORT_PIN_DISPLAY_DIGIT_DIRECTION               (OUTPUT)              /*Valid Range: input or output*/
+            #define PORT_PIN_DISPLAY_DIGIT_DIRECTION_CHANGEABLE    (DISABLE)             /*Valid Range: enable or disable*/
+            #define PORT_PIN_DISPLAY_DIGIT_INTIAL_MODE             (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_DISPLAY_DIGIT_LEVEL_VALUE             (PORT_PIN_LEVEL_LOW)  /*Valid Range: High or Low*/
+            #define PORT_PIN_DISPLAY_DIGIT_MODE                    (PORT_PIN_MODE_DIO)   /*Valid Range: one of supported modes above */
+            #define PORT_PIN_DISPLAY_DIGIT_CHANGEABLE              (DISABLE)             /*Valid Range: enable or disable*/
+            /* Non AUTOSAR Configuration*/
+            #define PORT_PIN_DISPLAY_DIGIT_PORT_ID                 (PORT_A)
+            #define PORT_PIN_DISPLAY_DIGIT_INTERNAL_RESISTOR       (OFF)
+
+    /************************************************************************************
+    | Non AUTOSAR Configuration: open drain output pins of each port (bit n --> pin n), the
+    | other output pins are push-pull. A high level of an open drain pin releases the line.
+    | The keypad rows are open drain, so a released row is never shorted to the driven row
+    | through two pressed keys of the same column.
+     ***********************************************************************************/
+
+    #define PORT_PORTA_OPEN_DRAIN_PINS                  (0x00U)
+    #define PORT_PORTB_OPEN_DRAIN_PINS                  (0x00U)
+    #define PORT_PORTC_OPEN_DRAIN_PINS                  (0x00U)
+    #define PORT_PORTD_OPEN_DRAIN_PINS                  (0x00U)
+    #define PORT_PORTE_OPEN_DRAIN_PINS                  (0x0FU)
+    #define PORT_PORTF_OPEN_DRAIN_PINS                  (0x00U)
+
 /************************************************************************************************/
 
 
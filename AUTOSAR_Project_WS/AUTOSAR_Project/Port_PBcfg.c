@@ -65,135 +65,149 @@ const Port_ConfigType Port_Configuration = {
         PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
         PORT_PIN_DEFAULT_INITIAL_VALUE,
         PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 2 *****************************/
-        PORT_A,
+        /************************** PIN 2 *****************************
+         ***************** Configured as DISPLAY_DIGIT0 ****************/
+        PORT_PIN_DISPLAY_DIGIT_PORT_ID,
         PIN2_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 3 *****************************/
-        PORT_A,
+        PORT_PIN_DISPLAY_DIGIT_MODE,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_DIGIT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_DIGIT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_DIGIT_CHANGEABLE,
+        /************************** PIN 3 *****************************
+         ***************** Configured as DISPLAY_DIGIT1 ****************/
+        PORT_PIN_DISPLAY_DIGIT_PORT_ID,
         PIN3_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 4 *****************************/
-        PORT_A,
+        PORT_PIN_DISPLAY_DIGIT_MODE,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_DIGIT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_DIGIT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_DIGIT_CHANGEABLE,
+        /************************** PIN 4 *****************************
+         ***************** Configured as DISPLAY_DIGIT2 ****************/
+        PORT_PIN_DISPLAY_DIGIT_PORT_ID,
         PIN4_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 5 *****************************/
-        PORT_A,
+        PORT_PIN_DISPLAY_DIGIT_MODE,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_DIGIT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_DIGIT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_DIGIT_CHANGEABLE,
+        /************************** PIN 5 *****************************
+         ***************** Configured as DISPLAY_DIGIT3 ****************/
+        PORT_PIN_DISPLAY_DIGIT_PORT_ID,
         PIN5_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 6 *****************************/
-        PORT_A,
-        PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 7 *****************************/
-        PORT_A,
+        PORT_PIN_DISPLAY_DIGIT_MODE,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION,
+        PORT_PIN_DISPLAY_DIGIT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_DIGIT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_DIGIT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_DIGIT_CHANGEABLE,
+        /************************** PIN 6 *****************************
+         ********************* Configured as M1PWM2 ********************/
+        PORT_PIN_PWM_M1_PORT_ID,
         PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
+        PORT_PIN_PWM_M1_MODE,
+        PORT_PIN_PWM_M1_DIRECTION,
+        PORT_PIN_PWM_M1_DIRECTION_CHANGEABLE,
+        PORT_PIN_PWM_M1_INTERNAL_RESISTOR,
+        PORT_PIN_PWM_M1_LEVEL_VALUE,
+        PORT_PIN_PWM_M1_CHANGEABLE,
+        /************************** PIN 7 *****************************
+         ********************* Configured as M1PWM3 ********************/
+        PORT_PIN_PWM_M1_PORT_ID,
+        PIN7_PIN_NUM,
+        PORT_PIN_PWM_M1_MODE,
+        PORT_PIN_PWM_M1_DIRECTION,
+        PORT_PIN_PWM_M1_DIRECTION_CHANGEABLE,
+        PORT_PIN_PWM_M1_INTERNAL_RESISTOR,
+        PORT_PIN_PWM_M1_LEVEL_VALUE,
+        PORT_PIN_PWM_M1_CHANGEABLE,
         /**************************************************************
          *                          PORT B
          **************************************************************/
-        /************************** PIN 0 *****************************/
-        PORT_B,
+        /************************** PIN 0 *****************************
+         ***************** Configured as DISPLAY_SEG_A *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN0_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 1 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 1 *****************************
+         ***************** Configured as DISPLAY_SEG_B *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN1_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 2 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 2 *****************************
+         ***************** Configured as DISPLAY_SEG_C *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN2_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 3 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 3 *****************************
+         ***************** Configured as DISPLAY_SEG_D *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN3_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 4 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 4 *****************************
+         ***************** Configured as DISPLAY_SEG_E *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN4_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 5 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 5 *****************************
+         ***************** Configured as DISPLAY_SEG_F *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN5_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 6 *****************************/
-        PORT_B,
-        PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 7 *****************************/
-        PORT_B,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 6 *****************************
+         ***************** Configured as DISPLAY_SEG_G *****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
         PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
+        /************************** PIN 7 *****************************
+         ***************** Configured as DISPLAY_SEG_DP ****************/
+        PORT_PIN_DISPLAY_SEGMENT_PORT_ID,
+        PIN7_PIN_NUM,
+        PORT_PIN_DISPLAY_SEGMENT_MODE,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION,
+        PORT_PIN_DISPLAY_SEGMENT_DIRECTION_CHANGEABLE,
+        PORT_PIN_DISPLAY_SEGMENT_INTERNAL_RESISTOR,
+        PORT_PIN_DISPLAY_SEGMENT_LEVEL_VALUE,
+        PORT_PIN_DISPLAY_SEGMENT_CHANGEABLE,
         /**************************************************************
          *                          PORT C
          **************************************************************/
@@ -233,42 +247,46 @@ const Port_ConfigType Port_Configuration = {
         PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
         PORT_PIN_DEFAULT_INITIAL_VALUE,
         PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 4 *****************************/
-        PORT_C,
+        /************************** PIN 4 *****************************
+         ****************** Configured as KEYPAD_COL0 ******************/
+        PORT_PIN_KEYPAD_COLUMN_PORT_ID,
         PIN4_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 5 *****************************/
-        PORT_C,
+        PORT_PIN_KEYPAD_COLUMN_MODE,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_COLUMN_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_COLUMN_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_COLUMN_CHANGEABLE,
+        /************************** PIN 5 *****************************
+         ****************** Configured as KEYPAD_COL1 ******************/
+        PORT_PIN_KEYPAD_COLUMN_PORT_ID,
         PIN5_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 6 *****************************/
-        PORT_C,
-        PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 7 *****************************/
-        PORT_C,
+        PORT_PIN_KEYPAD_COLUMN_MODE,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_COLUMN_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_COLUMN_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_COLUMN_CHANGEABLE,
+        /************************** PIN 6 *****************************
+         ****************** Configured as KEYPAD_COL2 ******************/
+        PORT_PIN_KEYPAD_COLUMN_PORT_ID,
         PIN6_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
+        PORT_PIN_KEYPAD_COLUMN_MODE,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_COLUMN_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_COLUMN_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_COLUMN_CHANGEABLE,
+        /************************** PIN 7 *****************************
+         ****************** Configured as KEYPAD_COL3 ******************/
+        PORT_PIN_KEYPAD_COLUMN_PORT_ID,
+        PIN7_PIN_NUM,
+        PORT_PIN_KEYPAD_COLUMN_MODE,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION,
+        PORT_PIN_KEYPAD_COLUMN_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_COLUMN_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_COLUMN_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_COLUMN_CHANGEABLE,
         /**************************************************************
          *                          PORT D
          **************************************************************/
@@ -337,7 +355,7 @@ const Port_ConfigType Port_Configuration = {
         PORT_PIN_DEFAULT_MODE_CHANGEABLE,
         /************************** PIN 7 *****************************/
         PORT_D,
-        PIN6_PIN_NUM,
+        PIN7_PIN_NUM,
         PORT_PIN_DEFAULT_MODE,
         PORT_PIN_DEFAULT_DIRECTION,
         PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
@@ -347,60 +365,66 @@ const Port_ConfigType Port_Configuration = {
         /**************************************************************
          *                          PORT E
          **************************************************************/
-        /************************** PIN 0 *****************************/
-        PORT_E,
+        /************************** PIN 0 *****************************
+         ****************** Configured as KEYPAD_ROW0 ******************/
+        PORT_PIN_KEYPAD_ROW_PORT_ID,
         PIN0_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 1 *****************************/
-        PORT_E,
+        PORT_PIN_KEYPAD_ROW_MODE,
+        PORT_PIN_KEYPAD_ROW_DIRECTION,
+        PORT_PIN_KEYPAD_ROW_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_ROW_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_ROW_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_ROW_CHANGEABLE,
+        /************************** PIN 1 *****************************
+         ****************** Configured as KEYPAD_ROW1 ******************/
+        PORT_PIN_KEYPAD_ROW_PORT_ID,
         PIN1_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 2 *****************************/
-        PORT_E,
+        PORT_PIN_KEYPAD_ROW_MODE,
+        PORT_PIN_KEYPAD_ROW_DIRECTION,
+        PORT_PIN_KEYPAD_ROW_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_ROW_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_ROW_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_ROW_CHANGEABLE,
+        /************************** PIN 2 *****************************
+         ****************** Configured as KEYPAD_ROW2 ******************/
+        PORT_PIN_KEYPAD_ROW_PORT_ID,
         PIN2_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 3 *****************************/
-        PORT_E,
+        PORT_PIN_KEYPAD_ROW_MODE,
+        PORT_PIN_KEYPAD_ROW_DIRECTION,
+        PORT_PIN_KEYPAD_ROW_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_ROW_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_ROW_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_ROW_CHANGEABLE,
+        /************************** PIN 3 *****************************
+         ****************** Configured as KEYPAD_ROW3 ******************/
+        PORT_PIN_KEYPAD_ROW_PORT_ID,
         PIN3_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 4 *****************************/
-        PORT_E,
+        PORT_PIN_KEYPAD_ROW_MODE,
+        PORT_PIN_KEYPAD_ROW_DIRECTION,
+        PORT_PIN_KEYPAD_ROW_DIRECTION_CHANGEABLE,
+        PORT_PIN_KEYPAD_ROW_INTERNAL_RESISTOR,
+        PORT_PIN_KEYPAD_ROW_LEVEL_VALUE,
+        PORT_PIN_KEYPAD_ROW_CHANGEABLE,
+        /************************** PIN 4 *****************************
+         ********************* Configured as M0PWM4 ********************/
+        PORT_PIN_PWM_M0_PORT_ID,
         PIN4_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 5 *****************************/
-        PORT_E,
+        PORT_PIN_PWM_M0_MODE,
+        PORT_PIN_PWM_M0_DIRECTION,
+        PORT_PIN_PWM_M0_DIRECTION_CHANGEABLE,
+        PORT_PIN_PWM_M0_INTERNAL_RESISTOR,
+        PORT_PIN_PWM_M0_LEVEL_VALUE,
+        PORT_PIN_PWM_M0_CHANGEABLE,
+        /************************** PIN 5 *****************************
+         ********************* Configured as M0PWM5 ********************/
+        PORT_PIN_PWM_M0_PORT_ID,
         PIN5_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
+        PORT_PIN_PWM_M0_MODE,
+        PORT_PIN_PWM_M0_DIRECTION,
+        PORT_PIN_PWM_M0_DIRECTION_CHANGEABLE,
+        PORT_PIN_PWM_M0_INTERNAL_RESISTOR,
+        PORT_PIN_PWM_M0_LEVEL_VALUE,
+        PORT_PIN_PWM_M0_CHANGEABLE,
         /**************************************************************
          *                          PORT F
          **************************************************************/
@@ -423,24 +447,26 @@ const Port_ConfigType Port_Configuration = {
         PORT_PIN_LED_INTERNAL_RESISTOR,
         PORT_PIN_LED_LEVEL_VALUE,
         PORT_PIN_LED_CHANGEABLE,
-        /************************** PIN 2 *****************************/
-        PORT_F,
-        PIN2_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
-        /************************** PIN 3 *****************************/
-        PORT_F,
-        PIN3_PIN_NUM,
-        PORT_PIN_DEFAULT_MODE,
-        PORT_PIN_DEFAULT_DIRECTION,
-        PORT_PIN_DEFAULT_DIRECTION_CHANGEABLE,
-        PORT_PIN_DEFAULT_INTERNAL_RESISTOR,
-        PORT_PIN_DEFAULT_INITIAL_VALUE,
-        PORT_PIN_DEFAULT_MODE_CHANGEABLE,
+        /************************** PIN 2 *****************************
+         ****************** Configured as LED_BLUE *******************/
+        PORT_PIN_LED_BLUE_PORT_ID,
+        PORT_PIN_LED_BLUE_ID,
+        PORT_PIN_LED_BLUE_MODE,
+        PORT_PIN_LED_BLUE_DIRECTION,
+        PORT_PIN_LED_BLUE_DIRECTION_CHANGEABLE,
+        PORT_PIN_LED_BLUE_INTERNAL_RESISTOR,
+        PORT_PIN_LED_BLUE_LEVEL_VALUE,
+        PORT_PIN_LED_BLUE_CHANGEABLE,
+        /************************** PIN 3 *****************************
+         ***************** Configured as LED_GREEN *******************/
+        PORT_PIN_LED_GREEN_PORT_ID,
+        PORT_PIN_LED_GREEN_ID,
+        PORT_PIN_LED_GREEN_MODE,
+        PORT_PIN_LED_GREEN_DIRECTION,
+        PORT_PIN_LED_GREEN_DIRECTION_CHANGEABLE,
+        PORT_PIN_LED_GREEN_INTERNAL_RESISTOR,
+        PORT_PIN_LED_GREEN_LEVEL_VALUE,
+        PORT_PIN_LED_GREEN_CHANGEABLE,
         /************************** PIN 4 *****************************
          ******************* Configured as BUTTON ********************/
         PORT_PIN_BUTTON_PORT_ID,
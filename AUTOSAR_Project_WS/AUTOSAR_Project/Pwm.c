@@ -0,0 +1,915 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Pwm.h"
+#include "Pwm_Regs.h"
+#include "tm4c123gh6pm_registers.h"
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+#include "Irq.h"
+#endif
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Pwm Modules */
+#if ((DET_AR_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ || (DET_AR_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ || (DET_AR_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* PWMDIV field of the RCC register for the configured PWM clock divider */
+#if (PWM_CLOCK_DIVIDER == 1U)
+#define PWM_RCC_DIVIDER_VALUE          (0U)
+#elif (PWM_CLOCK_DIVIDER == 2U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x0UL << PWM_RCC_PWMDIV_POS))
+#elif (PWM_CLOCK_DIVIDER == 4U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x1UL << PWM_RCC_PWMDIV_POS))
+#elif (PWM_CLOCK_DIVIDER == 8U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x2UL << PWM_RCC_PWMDIV_POS))
+#elif (PWM_CLOCK_DIVIDER == 16U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x3UL << PWM_RCC_PWMDIV_POS))
+#elif (PWM_CLOCK_DIVIDER == 32U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x4UL << PWM_RCC_PWMDIV_POS))
+#elif (PWM_CLOCK_DIVIDER == 64U)
+#define PWM_RCC_DIVIDER_VALUE          (PWM_RCC_USEPWMDIV_BIT | (0x5UL << PWM_RCC_PWMDIV_POS))
+#else
+  #error "PWM_CLOCK_DIVIDER shall be 1, 2, 4, 8, 16, 32 or 64"
+#endif
+
+/* Number of the Motion Control Modules and of the generators of one module */
+#define PWM_NUMBER_OF_MODULES          (2U)
+#define PWM_GENERATORS_PER_MODULE      (4U)
+
+/* Generator and side (A for the even outputs, B for the odd outputs) of a module output */
+#define PWM_OUTPUT_GENERATOR(OUTPUT)   ((uint8)((OUTPUT) >> 1))
+#define PWM_OUTPUT_IS_B(OUTPUT)        (((OUTPUT) & 1U) != 0U)
+
+/* Value of Pwm_GenChannel for the generator sides without configured channel */
+#define PWM_NO_CHANNEL                 (0xFFU)
+
+/*
+ * Generator CTL: count-down mode, LOAD/CMPA/CMPB/GENA/GENB written by the driver are held until the
+ * generator bit is set in the module CTL (GLOBALSYNC) and then applied when the counter reaches zero.
+ */
+#define PWM_GEN_CTL_ENABLE             (0x001U)
+#define PWM_GEN_CTL_LOADUPD            (0x008U)
+#define PWM_GEN_CTL_CMPAUPD            (0x010U)
+#define PWM_GEN_CTL_CMPBUPD            (0x020U)
+#define PWM_GEN_CTL_GENAUPD_GLOBAL     (0x0C0U)
+#define PWM_GEN_CTL_GENBUPD_GLOBAL     (0x300U)
+#define PWM_GEN_CTL_GLOBAL_SYNC        (PWM_GEN_CTL_LOADUPD | PWM_GEN_CTL_CMPAUPD | PWM_GEN_CTL_CMPBUPD \
+                                       | PWM_GEN_CTL_GENAUPD_GLOBAL | PWM_GEN_CTL_GENBUPD_GLOBAL)
+
+/* GENA/GENB actions: the output is driven high at the load of the counter and low when it crosses the compare */
+#define PWM_GEN_ACTLOAD_LOW            (0x2U << 2)
+#define PWM_GEN_ACTLOAD_HIGH           (0x3U << 2)
+#define PWM_GEN_ACTCMPAD_LOW           (0x2U << 6)
+#define PWM_GEN_ACTCMPBD_LOW           (0x2U << 10)
+
+/* Generator interrupt events: counter load (start of the duty cycle) and compare A/B going down (end) */
+#define PWM_GEN_INT_LOAD               (0x02U)
+#define PWM_GEN_INT_CMPAD              (0x08U)
+#define PWM_GEN_INT_CMPBD              (0x20U)
+
+/* Any register of a module */
+#define PWM_MODULE_REG(MODULE,OFFSET) \
+    (*(volatile uint32 *)(Pwm_ModuleBaseAddress[(MODULE)] + (OFFSET)))
+
+/* Any register of a generator of a module */
+#define PWM_GEN_REG(MODULE,GEN,OFFSET) \
+    (*(volatile uint32 *)(Pwm_ModuleBaseAddress[(MODULE)] + PWM_GEN_BLOCK_OFFSET(GEN) + (OFFSET)))
+
+/*
+ * Disable the interrupts around the updates of the pending generators, which are shared by the channel services
+ * called from the tasks and from the Pwm notifications, the PRIMASK value is saved and restored
+ */
+#define Pwm_EnterCritical(STATE)       ((STATE) = _disable_IRQ())
+#define Pwm_ExitCritical(STATE)        _restore_interrupts(STATE)
+
+/* Motion Control Modules base addresses indexed by the Module Id */
+STATIC const uint32 Pwm_ModuleBaseAddress[PWM_NUMBER_OF_MODULES] = {
+                                                                       PWM_MODULE0_BASE_ADDRESS,
+                                                                       PWM_MODULE1_BASE_ADDRESS
+                                                                   };
+
+STATIC const Pwm_ConfigChannel * Pwm_Channels = NULL_PTR;
+
+/* Current period of each generator, shared by its A and B outputs */
+STATIC Pwm_PeriodType Pwm_GenPeriod[PWM_NUMBER_OF_MODULES][PWM_GENERATORS_PER_MODULE];
+
+/* Channels of the A and B outputs of each generator, to keep the duty of the other output when the period changes */
+STATIC uint8 Pwm_GenChannel[PWM_NUMBER_OF_MODULES][PWM_GENERATORS_PER_MODULE][2];
+
+/* Last duty cycle requested for each channel */
+STATIC volatile uint16 Pwm_ChannelDuty[PWM_CONFIGURED_CHANNELS];
+
+/* Generators with held changes of each module, committed together by one write of the module CTL */
+STATIC volatile uint8 Pwm_PendingSync[PWM_NUMBER_OF_MODULES];
+
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+/* TRUE between Pwm_StartUpdate and Pwm_CommitUpdate */
+STATIC boolean Pwm_UpdateStarted = FALSE;
+#endif
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/* Generator interrupt events enabled for each channel by Pwm_EnableNotification */
+STATIC uint8 Pwm_ChannelEvents[PWM_CONFIGURED_CHANNELS];
+
+/* Generator interrupts vector numbers indexed by the Module Id and the generator */
+STATIC const Irq_VectorType Pwm_GenVector[PWM_NUMBER_OF_MODULES][PWM_GENERATORS_PER_MODULE] = {
+    { IRQ_PWM0_GEN0_VECTOR, IRQ_PWM0_GEN1_VECTOR, IRQ_PWM0_GEN2_VECTOR, IRQ_PWM0_GEN3_VECTOR },
+    { IRQ_PWM1_GEN0_VECTOR, IRQ_PWM1_GEN1_VECTOR, IRQ_PWM1_GEN2_VECTOR, IRQ_PWM1_GEN3_VECTOR }
+};
+#endif
+
+STATIC uint8 Pwm_Status = PWM_NOT_INITIALIZED;
+
+/*
+ * Function to write the compare and the actions of one channel for a duty cycle at the current period of its
+ * generator. The registers are held by the generator until its pending changes are committed.
+ */
+STATIC void Pwm_WriteDuty(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    Pwm_ModuleType module = Pwm_Channels[ChannelNumber].Module;
+    uint8 output = Pwm_Channels[ChannelNumber].Output;
+    uint8 gen = PWM_OUTPUT_GENERATOR(output);
+    uint32 period = Pwm_GenPeriod[module][gen];
+    uint32 high;
+    uint32 compare = 0;
+    uint32 actions;
+    uint32 primask;
+
+    if(DutyCycle > PWM_DUTY_CYCLE_100)
+    {
+        DutyCycle = PWM_DUTY_CYCLE_100;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+
+    /* Counts of the duty cycle, the counter goes down from (period - 1) to 0 */
+    high = (period * DutyCycle) >> 15;
+
+    if(0U == high)
+    {
+        /* 0% ... constant inactive level, the compare is not used */
+        actions = PWM_GEN_ACTLOAD_LOW;
+    }
+    else if(high >= period)
+    {
+        /* 100% ... constant active level, the compare is not used */
+        actions = PWM_GEN_ACTLOAD_HIGH;
+    }
+    else
+    {
+        compare = (period - 1U) - high;
+        actions = PWM_GEN_ACTLOAD_HIGH | (PWM_OUTPUT_IS_B(output) ? PWM_GEN_ACTCMPBD_LOW : PWM_GEN_ACTCMPAD_LOW);
+    }
+
+    if(PWM_OUTPUT_IS_B(output))
+    {
+        PWM_GEN_REG(module,gen,PWM_GEN_CMPB_REG_OFFSET) = compare;
+        PWM_GEN_REG(module,gen,PWM_GEN_GENB_REG_OFFSET) = actions;
+    }
+    else
+    {
+        PWM_GEN_REG(module,gen,PWM_GEN_CMPA_REG_OFFSET) = compare;
+        PWM_GEN_REG(module,gen,PWM_GEN_GENA_REG_OFFSET) = actions;
+    }
+
+    Pwm_ChannelDuty[ChannelNumber] = DutyCycle;
+    Pwm_EnterCritical(primask);
+    Pwm_PendingSync[module] |= (uint8)(1U << gen);
+    Pwm_ExitCritical(primask);
+}
+
+/* Function to write the period of a generator, both its outputs keep their duty cycle */
+STATIC void Pwm_WritePeriod(Pwm_ModuleType Module, uint8 Gen, Pwm_PeriodType Period)
+{
+    uint8 side;
+
+    Pwm_GenPeriod[Module][Gen] = Period;
+    PWM_GEN_REG(Module,Gen,PWM_GEN_LOAD_REG_OFFSET) = (uint32)Period - 1U;
+
+    for(side = 0; side < 2U; side++)
+    {
+        uint8 channel = Pwm_GenChannel[Module][Gen][side];
+
+        if(PWM_NO_CHANNEL != channel)
+        {
+            Pwm_WriteDuty(channel,Pwm_ChannelDuty[channel]);
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/*
+ * Function to commit the held changes of the generators: one write of each module CTL, so all the changes
+ * of a module reach its generators together at their next period boundary. Deferred by Pwm_StartUpdate.
+ * The pending generators are read and cleared with the interrupts disabled, so a generator made pending by
+ * a Pwm notification in between is not lost.
+ */
+STATIC void Pwm_Commit(void)
+{
+    uint8 module;
+    uint32 primask;
+
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+    if(FALSE == Pwm_UpdateStarted)
+#endif
+    {
+        for(module = 0; module < PWM_NUMBER_OF_MODULES; module++)
+        {
+            Pwm_EnterCritical(primask);
+            if(0U != Pwm_PendingSync[module])
+            {
+                PWM_MODULE_REG(module,PWM_CTL_REG_OFFSET) = Pwm_PendingSync[module];
+                Pwm_PendingSync[module] = 0;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+            Pwm_ExitCritical(primask);
+        }
+    }
+}
+
+/* Function to get the duty cycle which holds a channel at a level */
+STATIC uint16 Pwm_LevelDuty(Pwm_ChannelType ChannelNumber, Pwm_OutputStateType Level)
+{
+    /* The duty cycle is at the Polarity level, an inactive output is at the other level */
+    return (Level == Pwm_Channels[ChannelNumber].Polarity) ? PWM_DUTY_CYCLE_100 : 0U;
+}
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/* Function to handle the interrupt of one generator */
+STATIC void Pwm_GenHandler(Pwm_ModuleType Module, uint8 Gen)
+{
+    /* Read the pending events once and clear them with a single write */
+    uint8 pending = (uint8)PWM_GEN_REG(Module,Gen,PWM_GEN_ISC_REG_OFFSET);
+    uint8 side;
+
+    PWM_GEN_REG(Module,Gen,PWM_GEN_ISC_REG_OFFSET) = pending;
+
+    for(side = 0; side < 2U; side++)
+    {
+        uint8 channel = Pwm_GenChannel[Module][Gen][side];
+
+        /* No edge and no notification at 0% and 100% */
+        if((PWM_NO_CHANNEL != channel) && (0U != (pending & Pwm_ChannelEvents[channel]))
+           && (0U != Pwm_ChannelDuty[channel]) && (PWM_DUTY_CYCLE_100 != Pwm_ChannelDuty[channel]))
+        {
+            Pwm_Channels[channel].Notification();
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+}
+
+/* Interrupt handlers of the generators installed by Pwm_Init */
+#define PWM_DEFINE_GEN_HANDLER(MODULE,GEN) \
+STATIC void Pwm_Module##MODULE##Gen##GEN##_Handler(void) \
+{ \
+    Pwm_GenHandler(MODULE,GEN); \
+}
+
+PWM_DEFINE_GEN_HANDLER(0,0)
+PWM_DEFINE_GEN_HANDLER(0,1)
+PWM_DEFINE_GEN_HANDLER(0,2)
+PWM_DEFINE_GEN_HANDLER(0,3)
+PWM_DEFINE_GEN_HANDLER(1,0)
+PWM_DEFINE_GEN_HANDLER(1,1)
+PWM_DEFINE_GEN_HANDLER(1,2)
+PWM_DEFINE_GEN_HANDLER(1,3)
+
+STATIC const Irq_HandlerType Pwm_GenHandlers[PWM_NUMBER_OF_MODULES][PWM_GENERATORS_PER_MODULE] = {
+    { Pwm_Module0Gen0_Handler, Pwm_Module0Gen1_Handler, Pwm_Module0Gen2_Handler, Pwm_Module0Gen3_Handler },
+    { Pwm_Module1Gen0_Handler, Pwm_Module1Gen1_Handler, Pwm_Module1Gen2_Handler, Pwm_Module1Gen3_Handler }
+};
+
+/* Function to write the interrupt events of a generator from the enabled events of its two channels */
+STATIC void Pwm_WriteGenEvents(Pwm_ModuleType Module, uint8 Gen)
+{
+    uint32 events = 0;
+    uint8 side;
+
+    for(side = 0; side < 2U; side++)
+    {
+        uint8 channel = Pwm_GenChannel[Module][Gen][side];
+
+        if(PWM_NO_CHANNEL != channel)
+        {
+            events |= Pwm_ChannelEvents[channel];
+        }
+        else
+        {
+            /* No Action Required */
+        }
+    }
+
+    PWM_GEN_REG(Module,Gen,PWM_GEN_INTEN_REG_OFFSET) = events;
+}
+#endif
+
+/* Function to check the state of the driver and the channel of an API, returns TRUE in case of error */
+STATIC boolean Pwm_CheckChannel(Pwm_ChannelType ChannelNumber, uint8 ServiceId)
+{
+    boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PWM_NOT_INITIALIZED == Pwm_Status)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                ServiceId, PWM_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used channel is within the valid range */
+    if (PWM_CONFIGURED_CHANNELS <= ChannelNumber)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                ServiceId, PWM_E_PARAM_CHANNEL);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    return error;
+}
+
+/************************************************************************************
+* Service Name: Pwm_Init
+* Service ID[hex]: 0x00
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): ConfigPtr - Pointer to post-build configuration data
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to Initialize the Pwm module: enable the clocks of the used modules, start their
+*              generators with the default periods and duty cycles and align their counters.
+************************************************************************************/
+void Pwm_Init(const Pwm_ConfigType * ConfigPtr)
+{
+    boolean error = FALSE;
+    uint8 modules = 0;
+    uint8 outputs[PWM_NUMBER_OF_MODULES] = {0, 0};
+    uint8 gens[PWM_NUMBER_OF_MODULES] = {0, 0};
+    uint8 index;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if (NULL_PTR == ConfigPtr)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID,
+             PWM_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else if (PWM_INITIALIZED == Pwm_Status)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID, PWM_INIT_SID,
+             PWM_E_ALREADY_INITIALIZED);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Pwm_Channels = ConfigPtr->Channels;
+
+        for(index = 0; index < PWM_NUMBER_OF_MODULES; index++)
+        {
+            uint8 gen;
+
+            for(gen = 0; gen < PWM_GENERATORS_PER_MODULE; gen++)
+            {
+                Pwm_GenChannel[index][gen][0] = PWM_NO_CHANNEL;
+                Pwm_GenChannel[index][gen][1] = PWM_NO_CHANNEL;
+            }
+            Pwm_PendingSync[index] = 0;
+        }
+
+        /* Collect the used modules, generators and outputs */
+        for(index = 0; index < PWM_CONFIGURED_CHANNELS; index++)
+        {
+            Pwm_ModuleType module = Pwm_Channels[index].Module;
+            uint8 output = Pwm_Channels[index].Output;
+
+            modules         |= (uint8)(1U << module);
+            outputs[module] |= (uint8)(1U << output);
+            gens[module]    |= (uint8)(1U << PWM_OUTPUT_GENERATOR(output));
+            Pwm_GenChannel[module][PWM_OUTPUT_GENERATOR(output)][PWM_OUTPUT_IS_B(output) ? 1U : 0U] = index;
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+            Pwm_ChannelEvents[index] = 0;
+#endif
+        }
+
+        /* Enable clock for the used modules and wait for clock to start */
+        SYSCTL_RCGCPWM_REG |= modules;
+        while((SYSCTL_PRPWM_REG & modules) != modules);
+
+        /* Both modules are clocked by the system clock through the same divider */
+        SYSCTL_RCC_REG = (SYSCTL_RCC_REG & ~(PWM_RCC_USEPWMDIV_BIT | PWM_RCC_PWMDIV_MASK)) | PWM_RCC_DIVIDER_VALUE;
+
+        for(index = 0; index < PWM_NUMBER_OF_MODULES; index++)
+        {
+            uint8 gen;
+
+            /* Only the clocked modules are accessed */
+            if(0U != (modules & (1U << index)))
+            {
+                /* Outputs disabled and generators stopped during the configuration */
+                PWM_MODULE_REG(index,PWM_ENABLE_REG_OFFSET) &= ~(uint32)outputs[index];
+
+                for(gen = 0; gen < PWM_GENERATORS_PER_MODULE; gen++)
+                {
+                    if(0U != (gens[index] & (1U << gen)))
+                    {
+                        PWM_GEN_REG(index,gen,PWM_GEN_CTL_REG_OFFSET)   = PWM_GEN_CTL_GLOBAL_SYNC;
+                        PWM_GEN_REG(index,gen,PWM_GEN_INTEN_REG_OFFSET) = 0;
+                        PWM_GEN_REG(index,gen,PWM_GEN_ISC_REG_OFFSET)   = 0xFFFFFFFF;
+                    }
+                    else
+                    {
+                        /* No Action Required */
+                    }
+                }
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+
+        /* Default period of each generator (from the first of its channels), then the default duty cycles */
+        for(index = PWM_CONFIGURED_CHANNELS; index > 0U; index--)
+        {
+            Pwm_ModuleType module = Pwm_Channels[index - 1U].Module;
+
+            Pwm_GenPeriod[module][PWM_OUTPUT_GENERATOR(Pwm_Channels[index - 1U].Output)] = Pwm_Channels[index - 1U].Period;
+        }
+        for(index = 0; index < PWM_CONFIGURED_CHANNELS; index++)
+        {
+            Pwm_ModuleType module = Pwm_Channels[index].Module;
+            uint8 output = Pwm_Channels[index].Output;
+            uint8 gen = PWM_OUTPUT_GENERATOR(output);
+
+            PWM_GEN_REG(module,gen,PWM_GEN_LOAD_REG_OFFSET) = (uint32)Pwm_GenPeriod[module][gen] - 1U;
+            Pwm_WriteDuty(index,Pwm_Channels[index].DutyCycle);
+
+            /* The output level is inverted for the channels active low */
+            if(PWM_LOW == Pwm_Channels[index].Polarity)
+            {
+                PWM_MODULE_REG(module,PWM_INVERT_REG_OFFSET) |= (uint32)(1U << output);
+            }
+            else
+            {
+                PWM_MODULE_REG(module,PWM_INVERT_REG_OFFSET) &= ~(uint32)(1U << output);
+            }
+        }
+
+        for(index = 0; index < PWM_NUMBER_OF_MODULES; index++)
+        {
+            uint8 gen;
+
+            /* Only the clocked modules are accessed */
+            if(0U != (modules & (1U << index)))
+            {
+                for(gen = 0; gen < PWM_GENERATORS_PER_MODULE; gen++)
+                {
+                    if(0U != (gens[index] & (1U << gen)))
+                    {
+                        PWM_GEN_REG(index,gen,PWM_GEN_CTL_REG_OFFSET) = PWM_GEN_CTL_GLOBAL_SYNC | PWM_GEN_CTL_ENABLE;
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+                        Irq_Register(Pwm_GenVector[index][gen],Pwm_GenHandlers[index][gen]);
+#endif
+                    }
+                    else
+                    {
+                        /* No Action Required */
+                    }
+                }
+
+                /*
+                 * Commit the default values then reset the counters of the used generators together: the reset is a
+                 * zero of the counters which applies the committed values, and the outputs of the module are in phase.
+                 */
+                PWM_MODULE_REG(index,PWM_CTL_REG_OFFSET)  = gens[index];
+                PWM_MODULE_REG(index,PWM_SYNC_REG_OFFSET) = gens[index];
+                Pwm_PendingSync[index] = 0;
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+                /* The generator interrupts reach the NVIC, each generator enables its events per channel */
+                PWM_MODULE_REG(index,PWM_INTEN_REG_OFFSET) |= gens[index];
+#endif
+
+                PWM_MODULE_REG(index,PWM_ENABLE_REG_OFFSET) |= outputs[index];
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+        Pwm_UpdateStarted = FALSE;
+#endif
+        Pwm_Status = PWM_INITIALIZED;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Pwm_DeInit
+* Service ID[hex]: 0x01
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set all the channels to their idle state and disable the notifications.
+*              The generators keep running with the idle levels as constant outputs.
+************************************************************************************/
+#if (PWM_DE_INIT_API == STD_ON)
+void Pwm_DeInit(void)
+{
+    uint8 index;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PWM_NOT_INITIALIZED == Pwm_Status)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_DEINIT_SID, PWM_E_UNINIT);
+    }
+    else
+#endif
+    {
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+        Pwm_UpdateStarted = FALSE;
+#endif
+        for(index = 0; index < PWM_CONFIGURED_CHANNELS; index++)
+        {
+            Pwm_WriteDuty(index,Pwm_LevelDuty(index,Pwm_Channels[index].IdleState));
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+            Pwm_ChannelEvents[index] = 0;
+            Pwm_WriteGenEvents(Pwm_Channels[index].Module,PWM_OUTPUT_GENERATOR(Pwm_Channels[index].Output));
+#endif
+        }
+        Pwm_Commit();
+
+        Pwm_Status = PWM_NOT_INITIALIZED;
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_SetDutyCycle
+* Service ID[hex]: 0x02
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the PWM channel
+*                  DutyCycle - 0x0000 (0%) --> 0x8000 (100%)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the duty cycle of a channel, applied at the end of its current period.
+************************************************************************************/
+#if (PWM_SET_DUTY_CYCLE_API == STD_ON)
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle)
+{
+    if(FALSE == Pwm_CheckChannel(ChannelNumber,PWM_SET_DUTY_CYCLE_SID))
+    {
+        Pwm_WriteDuty(ChannelNumber,DutyCycle);
+        Pwm_Commit();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_SetPeriodAndDuty
+* Service ID[hex]: 0x03
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the PWM channel
+*                  Period - Period in PWM clock counts (2 --> 65535), 0 sets the output inactive
+*                  DutyCycle - 0x0000 (0%) --> 0x8000 (100%)
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the period and the duty cycle of a variable period channel, applied at the
+*              end of its current period. The other output of the generator keeps its duty cycle.
+************************************************************************************/
+#if (PWM_SET_PERIOD_AND_DUTY_API == STD_ON)
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle)
+{
+    boolean error = Pwm_CheckChannel(ChannelNumber,PWM_SET_PERIOD_AND_DUTY_SID);
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the channel period can be changed */
+    if ((FALSE == error) && (PWM_FIXED_PERIOD == Pwm_Channels[ChannelNumber].Class))
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_SET_PERIOD_AND_DUTY_SID, PWM_E_PERIOD_UNCHANGEABLE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        if(Period < 2U)
+        {
+            /* A null period sets the output to 0% */
+            Pwm_WriteDuty(ChannelNumber,0U);
+        }
+        else
+        {
+            Pwm_ChannelDuty[ChannelNumber] = DutyCycle;
+            Pwm_WritePeriod(Pwm_Channels[ChannelNumber].Module,PWM_OUTPUT_GENERATOR(Pwm_Channels[ChannelNumber].Output),
+                            Period);
+        }
+        Pwm_Commit();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_SetOutputToIdle
+* Service ID[hex]: 0x04
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the PWM channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the output of a channel to its configured idle state at the end of its current
+*              period, the next Pwm_SetDutyCycle/Pwm_SetPeriodAndDuty restarts the PWM.
+************************************************************************************/
+#if (PWM_SET_OUTPUT_TO_IDLE_API == STD_ON)
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber)
+{
+    if(FALSE == Pwm_CheckChannel(ChannelNumber,PWM_SET_OUTPUT_TO_IDLE_SID))
+    {
+        Pwm_WriteDuty(ChannelNumber,Pwm_LevelDuty(ChannelNumber,Pwm_Channels[ChannelNumber].IdleState));
+        Pwm_Commit();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/************************************************************************************
+* Service Name: Pwm_DisableNotification
+* Service ID[hex]: 0x06
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the PWM channel
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to disable the edge notification of a channel.
+************************************************************************************/
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber)
+{
+    if(FALSE == Pwm_CheckChannel(ChannelNumber,PWM_DISABLE_NOTIFICATION_SID))
+    {
+        Pwm_ChannelEvents[ChannelNumber] = 0;
+        Pwm_WriteGenEvents(Pwm_Channels[ChannelNumber].Module,PWM_OUTPUT_GENERATOR(Pwm_Channels[ChannelNumber].Output));
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+/************************************************************************************
+* Service Name: Pwm_EnableNotification
+* Service ID[hex]: 0x07
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant for different channels
+* Parameters (in): ChannelNumber - Numeric identifier of the PWM channel
+*                  Notification - Edges of the output which call the configured notification
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to enable the edge notification of a channel, the rising edge of the output is the
+*              load of the counter (the end of the duty cycle when inverted) and the falling edge is the compare.
+************************************************************************************/
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification)
+{
+    boolean error = Pwm_CheckChannel(ChannelNumber,PWM_ENABLE_NOTIFICATION_SID);
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the channel has a notification to call */
+    if ((FALSE == error) && (NULL_PTR == Pwm_Channels[ChannelNumber].Notification))
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_ENABLE_NOTIFICATION_SID, PWM_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if((FALSE == error) && (NULL_PTR != Pwm_Channels[ChannelNumber].Notification))
+    {
+        uint8 start = PWM_GEN_INT_LOAD;
+        uint8 end = PWM_OUTPUT_IS_B(Pwm_Channels[ChannelNumber].Output) ? PWM_GEN_INT_CMPBD : PWM_GEN_INT_CMPAD;
+        uint8 rising = (PWM_HIGH == Pwm_Channels[ChannelNumber].Polarity) ? start : end;
+        uint8 falling = (PWM_HIGH == Pwm_Channels[ChannelNumber].Polarity) ? end : start;
+
+        /* Clear the old events of the channel so the first notification is for a new edge */
+        PWM_GEN_REG(Pwm_Channels[ChannelNumber].Module,PWM_OUTPUT_GENERATOR(Pwm_Channels[ChannelNumber].Output),
+                    PWM_GEN_ISC_REG_OFFSET) = (uint32)(start | end);
+
+        if(PWM_RISING_EDGE == Notification)
+        {
+            Pwm_ChannelEvents[ChannelNumber] = rising;
+        }
+        else if(PWM_FALLING_EDGE == Notification)
+        {
+            Pwm_ChannelEvents[ChannelNumber] = falling;
+        }
+        else
+        {
+            Pwm_ChannelEvents[ChannelNumber] = (uint8)(rising | falling);
+        }
+        Pwm_WriteGenEvents(Pwm_Channels[ChannelNumber].Module,PWM_OUTPUT_GENERATOR(Pwm_Channels[ChannelNumber].Output));
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+/************************************************************************************
+* Service Name: Pwm_StartUpdate
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to hold the changes of the following Set APIs in the generators until
+*              Pwm_CommitUpdate, the outputs keep their current waveforms meanwhile.
+************************************************************************************/
+void Pwm_StartUpdate(void)
+{
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PWM_NOT_INITIALIZED == Pwm_Status)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_START_UPDATE_SID, PWM_E_UNINIT);
+    }
+    else
+#endif
+    {
+        Pwm_UpdateStarted = TRUE;
+    }
+}
+
+/************************************************************************************
+* Service Name: Pwm_CommitUpdate
+* Service ID[hex]: 0x21
+* Sync/Async: Synchronous
+* Reentrancy: Non reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to commit the changes held since Pwm_StartUpdate with one write per module,
+*              all the changed channels of a module switch together at their next period boundary.
+************************************************************************************/
+void Pwm_CommitUpdate(void)
+{
+    boolean error = FALSE;
+
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (PWM_NOT_INITIALIZED == Pwm_Status)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_COMMIT_UPDATE_SID, PWM_E_UNINIT);
+        error = TRUE;
+    }
+    else if (FALSE == Pwm_UpdateStarted)
+    {
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_COMMIT_UPDATE_SID, PWM_E_UPDATE_SEQUENCE);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        Pwm_UpdateStarted = FALSE;
+        Pwm_Commit();
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+/************************************************************************************
+* Service Name: Pwm_GetVersionInfo
+* Service ID[hex]: 0x08
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): VersionInfo - Pointer to where to store the version information of this module.
+* Return value: None
+* Description: Function to get the version information of this module.
+************************************************************************************/
+#if (PWM_VERSION_INFO_API == STD_ON)
+void Pwm_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+#if (PWM_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if(NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(PWM_MODULE_ID, PWM_INSTANCE_ID,
+                PWM_GET_VERSION_INFO_SID, PWM_E_PARAM_POINTER);
+    }
+    else
+#endif /* (PWM_DEV_ERROR_DETECT == STD_ON) */
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)PWM_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)PWM_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)PWM_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)PWM_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)PWM_SW_PATCH_VERSION;
+    }
+}
+#endif
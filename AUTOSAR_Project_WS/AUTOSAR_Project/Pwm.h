@@ -0,0 +1,248 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef PWM_H
+#define PWM_H
+
+/* Id for the company in the AUTOSAR
+ * for example Mohamed Tarek's ID = 1000 :) */
+#define PWM_VENDOR_ID    (1000U)
+
+/* Pwm Module Id */
+#define PWM_MODULE_ID    (121U)
+
+/* Pwm Instance Id */
+#define PWM_INSTANCE_ID  (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_SW_MAJOR_VERSION           (1U)
+#define PWM_SW_MINOR_VERSION           (0U)
+#define PWM_SW_PATCH_VERSION           (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_AR_RELEASE_MAJOR_VERSION   (4U)
+#define PWM_AR_RELEASE_MINOR_VERSION   (0U)
+#define PWM_AR_RELEASE_PATCH_VERSION   (3U)
+
+/*
+ * Macros for Pwm Status
+ */
+#define PWM_INITIALIZED                (1U)
+#define PWM_NOT_INITIALIZED            (0U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Pwm Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (STD_TYPES_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* Pwm Pre-Compile Configuration Header file */
+#include "Pwm_Cfg.h"
+
+/* AUTOSAR Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PWM_CFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (PWM_CFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_Cfg.h and Pwm.h files */
+#if ((PWM_CFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION)\
+ ||  (PWM_CFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION)\
+ ||  (PWM_CFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+  #error "The SW version of Pwm_Cfg.h does not match the expected version"
+#endif
+
+/* Non AUTOSAR files */
+#include "Common_Macros.h"
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for PWM Init */
+#define PWM_INIT_SID                   (uint8)0x00
+
+/* Service ID for PWM DeInit */
+#define PWM_DEINIT_SID                 (uint8)0x01
+
+/* Service ID for PWM set Duty Cycle */
+#define PWM_SET_DUTY_CYCLE_SID         (uint8)0x02
+
+/* Service ID for PWM set Period and Duty */
+#define PWM_SET_PERIOD_AND_DUTY_SID    (uint8)0x03
+
+/* Service ID for PWM set Output to Idle */
+#define PWM_SET_OUTPUT_TO_IDLE_SID     (uint8)0x04
+
+/* Service ID for PWM Disable Notification */
+#define PWM_DISABLE_NOTIFICATION_SID   (uint8)0x06
+
+/* Service ID for PWM Enable Notification */
+#define PWM_ENABLE_NOTIFICATION_SID    (uint8)0x07
+
+/* Service ID for PWM GetVersionInfo */
+#define PWM_GET_VERSION_INFO_SID       (uint8)0x08
+
+/* Service IDs for PWM Synchronized Update APIs (Not exist in AUTOSAR 4.0.3 PWM SWS Document) */
+#define PWM_START_UPDATE_SID           (uint8)0x20
+#define PWM_COMMIT_UPDATE_SID          (uint8)0x21
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* Pwm_Init API service called with NULL pointer parameter */
+#define PWM_E_PARAM_CONFIG             (uint8)0x10
+
+/* API service used without module initialization */
+#define PWM_E_UNINIT                   (uint8)0x11
+
+/* API service used with an invalid channel identifier */
+#define PWM_E_PARAM_CHANNEL            (uint8)0x12
+
+/* Usage of unauthorized PWM service on PWM channel configured a fixed period */
+#define PWM_E_PERIOD_UNCHANGEABLE      (uint8)0x13
+
+/* API Pwm_Init service called while the PWM driver has already been initialized */
+#define PWM_E_ALREADY_INITIALIZED      (uint8)0x14
+
+/* API service called with a NULL pointer */
+#define PWM_E_PARAM_POINTER            (uint8)0x15
+
+/* Pwm_CommitUpdate called without Pwm_StartUpdate (Not exist in AUTOSAR 4.0.3 PWM SWS Document) */
+#define PWM_E_UPDATE_SEQUENCE          (uint8)0x20
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Pwm_ChannelType used by the PWM APIs */
+typedef uint8 Pwm_ChannelType;
+
+/* Type definition for Pwm_PeriodType used by the PWM APIs, in PWM clock counts */
+typedef uint16 Pwm_PeriodType;
+
+/* Type definition for Pwm_OutputStateType, the output level of a channel */
+typedef uint8 Pwm_OutputStateType;
+#define PWM_LOW                        (Pwm_OutputStateType)0x00
+#define PWM_HIGH                       (Pwm_OutputStateType)0x01
+
+/* Type definition for Pwm_EdgeNotificationType, the edges of a channel which call its notification */
+typedef uint8 Pwm_EdgeNotificationType;
+#define PWM_RISING_EDGE                (Pwm_EdgeNotificationType)0x00
+#define PWM_FALLING_EDGE               (Pwm_EdgeNotificationType)0x01
+#define PWM_BOTH_EDGES                 (Pwm_EdgeNotificationType)0x02
+
+/* Type definition for Pwm_ChannelClassType (PWM_FIXED_PERIOD_SHIFTED is not supported by this driver) */
+typedef uint8 Pwm_ChannelClassType;
+#define PWM_VARIABLE_PERIOD            (Pwm_ChannelClassType)0x00
+#define PWM_FIXED_PERIOD               (Pwm_ChannelClassType)0x01
+
+/* Type definition for the Motion Control Module of a channel */
+typedef uint8 Pwm_ModuleType;
+#define PWM_MODULE_0                   (Pwm_ModuleType)0x00
+#define PWM_MODULE_1                   (Pwm_ModuleType)0x01
+
+/* Duty cycle of 100%, the duty cycles are scaled from 0x0000 (0%) to 0x8000 (100%) */
+#define PWM_DUTY_CYCLE_100             (uint16)0x8000
+
+/* Type definition for the notification called from the generator interrupt */
+typedef void (*Pwm_NotificationType)(void);
+
+typedef struct
+{
+	/* Member contains the ID of the Motion Control Module of the channel */
+	Pwm_ModuleType Module;
+	/* Member contains the output of the module (MnPWM0 ... MnPWM7) */
+	uint8 Output;
+	/* Member contains the class of the channel */
+	Pwm_ChannelClassType Class;
+	/* Member contains the default period, shared by the two outputs of a generator */
+	Pwm_PeriodType Period;
+	/* Member contains the default duty cycle */
+	uint16 DutyCycle;
+	/* Member contains the level of the output during the duty cycle */
+	Pwm_OutputStateType Polarity;
+	/* Member contains the level of the output after Pwm_SetOutputToIdle/Pwm_DeInit */
+	Pwm_OutputStateType IdleState;
+	/* Member contains the function called at the enabled edges, or NULL_PTR */
+	Pwm_NotificationType Notification;
+}Pwm_ConfigChannel;
+
+/* Data Structure required for initializing the Pwm Driver */
+typedef struct Pwm_ConfigType
+{
+	Pwm_ConfigChannel Channels[PWM_CONFIGURED_CHANNELS];
+} Pwm_ConfigType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Function for PWM Initialization API */
+void Pwm_Init(const Pwm_ConfigType * ConfigPtr);
+
+#if (PWM_DE_INIT_API == STD_ON)
+/* Function for PWM De-Initialization API */
+void Pwm_DeInit(void);
+#endif
+
+#if (PWM_SET_DUTY_CYCLE_API == STD_ON)
+/* Function for PWM set Duty Cycle API */
+void Pwm_SetDutyCycle(Pwm_ChannelType ChannelNumber, uint16 DutyCycle);
+#endif
+
+#if (PWM_SET_PERIOD_AND_DUTY_API == STD_ON)
+/* Function for PWM set Period and Duty API */
+void Pwm_SetPeriodAndDuty(Pwm_ChannelType ChannelNumber, Pwm_PeriodType Period, uint16 DutyCycle);
+#endif
+
+#if (PWM_SET_OUTPUT_TO_IDLE_API == STD_ON)
+/* Function for PWM set Output to Idle API */
+void Pwm_SetOutputToIdle(Pwm_ChannelType ChannelNumber);
+#endif
+
+#if (PWM_NOTIFICATION_SUPPORTED == STD_ON)
+/* Function for PWM Disable Notification API */
+void Pwm_DisableNotification(Pwm_ChannelType ChannelNumber);
+
+/* Function for PWM Enable Notification API */
+void Pwm_EnableNotification(Pwm_ChannelType ChannelNumber, Pwm_EdgeNotificationType Notification);
+#endif
+
+#if (PWM_SYNC_UPDATE_API == STD_ON)
+/* Function to hold the changes of the following Set APIs until Pwm_CommitUpdate */
+void Pwm_StartUpdate(void);
+
+/* Function to apply the changes held since Pwm_StartUpdate together at the next period boundary */
+void Pwm_CommitUpdate(void);
+#endif
+
+/* Function for PWM Get Version Info API */
+#if (PWM_VERSION_INFO_API == STD_ON)
+void Pwm_GetVersionInfo(Std_VersionInfoType *versioninfo);
+#endif
+
+/*******************************************************************************
+ *                       External Variables                                    *
+ *******************************************************************************/
+
+/* Extern PB structures to be used by Pwm and other modules */
+extern const Pwm_ConfigType Pwm_Configuration;
+
+#endif /* PWM_H */
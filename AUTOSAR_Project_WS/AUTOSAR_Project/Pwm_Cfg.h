@@ -0,0 +1,109 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef PWM_CFG_H
+#define PWM_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_CFG_SW_MAJOR_VERSION              (1U)
+#define PWM_CFG_SW_MINOR_VERSION              (0U)
+#define PWM_CFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_CFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PWM_CFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PWM_CFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define PWM_DEV_ERROR_DETECT                (STD_ON)
+
+/* Pre-compile option for Version Info API */
+#define PWM_VERSION_INFO_API                (STD_OFF)
+
+/* Pre-compile options for presence of the optional APIs */
+#define PWM_DE_INIT_API                     (STD_ON)
+#define PWM_SET_DUTY_CYCLE_API              (STD_ON)
+#define PWM_SET_PERIOD_AND_DUTY_API         (STD_ON)
+#define PWM_SET_OUTPUT_TO_IDLE_API          (STD_ON)
+
+/* Pre-compile option for the edge notifications (Pwm_EnableNotification/Pwm_DisableNotification) */
+#define PWM_NOTIFICATION_SUPPORTED          (STD_ON)
+
+/*
+ * Pre-compile option for Pwm_StartUpdate/Pwm_CommitUpdate (Non AUTOSAR): the duty cycle and period changes
+ * between the two calls are held by the generators and applied together at the next period boundary.
+ */
+#define PWM_SYNC_UPDATE_API                 (STD_ON)
+
+/* PWM clock divider of the system clock shared by both modules: 1 (no divider), 2, 4, 8, 16, 32 or 64 */
+#define PWM_CLOCK_DIVIDER                   (1U)
+
+/* Number of the configured Pwm Channels */
+#define PWM_CONFIGURED_CHANNELS             (4U)
+
+/* Channel Index in the array of structures in Pwm_PBcfg.c */
+#define PwmConf_MOTOR_LEFT_CHANNEL_ID_INDEX  (Pwm_ChannelType)0x00
+#define PwmConf_MOTOR_RIGHT_CHANNEL_ID_INDEX (Pwm_ChannelType)0x01
+#define PwmConf_FAN_CHANNEL_ID_INDEX         (Pwm_ChannelType)0x02
+#define PwmConf_HEATER_CHANNEL_ID_INDEX      (Pwm_ChannelType)0x03
+
+/* PWM Configured Modules and Outputs: MnPWMx is output x of module n, on generator x/2 (A for x even, B for x odd) */
+#define PwmConf_MOTOR_LEFT_MODULE            PWM_MODULE_0   /* M0PWM4 on PORTE Pin4 */
+#define PwmConf_MOTOR_LEFT_OUTPUT            (uint8)4
+#define PwmConf_MOTOR_RIGHT_MODULE           PWM_MODULE_0   /* M0PWM5 on PORTE Pin5 */
+#define PwmConf_MOTOR_RIGHT_OUTPUT           (uint8)5
+#define PwmConf_FAN_MODULE                   PWM_MODULE_1   /* M1PWM2 on PORTA Pin6 */
+#define PwmConf_FAN_OUTPUT                   (uint8)2
+#define PwmConf_HEATER_MODULE                PWM_MODULE_1   /* M1PWM3 on PORTA Pin7 */
+#define PwmConf_HEATER_OUTPUT                (uint8)3
+
+/*
+ * PWM Configured Channel Classes ... PWM_VARIABLE_PERIOD or PWM_FIXED_PERIOD
+ * The two outputs of a generator share its period, only one of them shall have a variable period.
+ */
+#define PwmConf_MOTOR_LEFT_CLASS             PWM_VARIABLE_PERIOD
+#define PwmConf_MOTOR_RIGHT_CLASS            PWM_FIXED_PERIOD
+#define PwmConf_FAN_CLASS                    PWM_VARIABLE_PERIOD
+#define PwmConf_HEATER_CLASS                 PWM_FIXED_PERIOD
+
+/* PWM Configured Default Periods in PWM clock counts (2 --> 65535) ... 1 KHz with the 16 MHz clock */
+#define PwmConf_MOTOR_LEFT_PERIOD            (Pwm_PeriodType)16000
+#define PwmConf_MOTOR_RIGHT_PERIOD           (Pwm_PeriodType)16000
+#define PwmConf_FAN_PERIOD                   (Pwm_PeriodType)16000
+#define PwmConf_HEATER_PERIOD                (Pwm_PeriodType)16000
+
+/* PWM Configured Default Duty Cycles (0x0000 --> 0% ... 0x8000 --> 100%) */
+#define PwmConf_MOTOR_LEFT_DUTY_CYCLE        (uint16)0x0000
+#define PwmConf_MOTOR_RIGHT_DUTY_CYCLE       (uint16)0x0000
+#define PwmConf_FAN_DUTY_CYCLE               (uint16)0x0000
+#define PwmConf_HEATER_DUTY_CYCLE            (uint16)0x0000
+
+/* PWM Configured Polarities (level during the duty cycle) and Idle States ... PWM_HIGH or PWM_LOW */
+#define PwmConf_MOTOR_LEFT_POLARITY          PWM_HIGH
+#define PwmConf_MOTOR_LEFT_IDLE_STATE        PWM_LOW
+#define PwmConf_MOTOR_RIGHT_POLARITY         PWM_HIGH
+#define PwmConf_MOTOR_RIGHT_IDLE_STATE       PWM_LOW
+#define PwmConf_FAN_POLARITY                 PWM_HIGH
+#define PwmConf_FAN_IDLE_STATE               PWM_LOW
+#define PwmConf_HEATER_POLARITY              PWM_LOW
+#define PwmConf_HEATER_IDLE_STATE            PWM_HIGH
+
+/* PWM Configured Notifications called from the generator interrupt ... NULL_PTR for none */
+#define PwmConf_MOTOR_LEFT_NOTIFICATION      NULL_PTR
+#define PwmConf_MOTOR_RIGHT_NOTIFICATION     NULL_PTR
+#define PwmConf_FAN_NOTIFICATION             NULL_PTR
+#define PwmConf_HEATER_NOTIFICATION          NULL_PTR
+
+#endif /* PWM_CFG_H */
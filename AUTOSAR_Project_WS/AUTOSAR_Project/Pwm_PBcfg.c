@@ -0,0 +1,52 @@
+ /******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_PBcfg.c
+ *
+ * Description: Post Build Configuration Source file for TM4C123GH6PM Microcontroller - Pwm Driver
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#include "Pwm.h"
+
+/*
+ * Module Version 1.0.0
+ */
+#define PWM_PBCFG_SW_MAJOR_VERSION              (1U)
+#define PWM_PBCFG_SW_MINOR_VERSION              (0U)
+#define PWM_PBCFG_SW_PATCH_VERSION              (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define PWM_PBCFG_AR_RELEASE_MAJOR_VERSION     (4U)
+#define PWM_PBCFG_AR_RELEASE_MINOR_VERSION     (0U)
+#define PWM_PBCFG_AR_RELEASE_PATCH_VERSION     (3U)
+
+/* AUTOSAR Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_AR_RELEASE_MAJOR_VERSION != PWM_AR_RELEASE_MAJOR_VERSION)\
+ ||  (PWM_PBCFG_AR_RELEASE_MINOR_VERSION != PWM_AR_RELEASE_MINOR_VERSION)\
+ ||  (PWM_PBCFG_AR_RELEASE_PATCH_VERSION != PWM_AR_RELEASE_PATCH_VERSION))
+  #error "The AR version of PBcfg.c does not match the expected version"
+#endif
+
+/* Software Version checking between Pwm_PBcfg.c and Pwm.h files */
+#if ((PWM_PBCFG_SW_MAJOR_VERSION != PWM_SW_MAJOR_VERSION)\
+ ||  (PWM_PBCFG_SW_MINOR_VERSION != PWM_SW_MINOR_VERSION)\
+ ||  (PWM_PBCFG_SW_PATCH_VERSION != PWM_SW_PATCH_VERSION))
+  #error "The SW version of PBcfg.c does not match the expected version"
+#endif
+
+/* PB structure used with Pwm_Init API */
+const Pwm_ConfigType Pwm_Configuration = {
+                                             PwmConf_MOTOR_LEFT_MODULE,PwmConf_MOTOR_LEFT_OUTPUT,PwmConf_MOTOR_LEFT_CLASS,PwmConf_MOTOR_LEFT_PERIOD,
+                                             PwmConf_MOTOR_LEFT_DUTY_CYCLE,PwmConf_MOTOR_LEFT_POLARITY,PwmConf_MOTOR_LEFT_IDLE_STATE,PwmConf_MOTOR_LEFT_NOTIFICATION,
+                                             PwmConf_MOTOR_RIGHT_MODULE,PwmConf_MOTOR_RIGHT_OUTPUT,PwmConf_MOTOR_RIGHT_CLASS,PwmConf_MOTOR_RIGHT_PERIOD,
+                                             PwmConf_MOTOR_RIGHT_DUTY_CYCLE,PwmConf_MOTOR_RIGHT_POLARITY,PwmConf_MOTOR_RIGHT_IDLE_STATE,PwmConf_MOTOR_RIGHT_NOTIFICATION,
+                                             PwmConf_FAN_MODULE,PwmConf_FAN_OUTPUT,PwmConf_FAN_CLASS,PwmConf_FAN_PERIOD,
+                                             PwmConf_FAN_DUTY_CYCLE,PwmConf_FAN_POLARITY,PwmConf_FAN_IDLE_STATE,PwmConf_FAN_NOTIFICATION,
+                                             PwmConf_HEATER_MODULE,PwmConf_HEATER_OUTPUT,PwmConf_HEATER_CLASS,PwmConf_HEATER_PERIOD,
+                                             PwmConf_HEATER_DUTY_CYCLE,PwmConf_HEATER_POLARITY,PwmConf_HEATER_IDLE_STATE,PwmConf_HEATER_NOTIFICATION
+                                         };
@@ -0,0 +1,48 @@
+/******************************************************************************
+ *
+ * Module: Pwm
+ *
+ * File Name: Pwm_Regs.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Pwm Driver Registers
+ *
+ * Author: agent
+ ******************************************************************************/
+
+#ifndef PWM_REGS_H
+#define PWM_REGS_H
+
+#include "Std_Types.h"
+
+/* Motion Control Modules base addresses */
+#define PWM_MODULE0_BASE_ADDRESS           0x40028000
+#define PWM_MODULE1_BASE_ADDRESS           0x40029000
+
+/* Module registers offset addresses */
+#define PWM_CTL_REG_OFFSET                 0x000
+#define PWM_SYNC_REG_OFFSET                0x004
+#define PWM_ENABLE_REG_OFFSET              0x008
+#define PWM_INVERT_REG_OFFSET              0x00C
+#define PWM_INTEN_REG_OFFSET               0x014
+
+/* Offset address of the registers block of a PWM generator (0 --> 3) */
+#define PWM_GEN_BLOCK_OFFSET(GEN)          (0x040 + ((GEN) * 0x040))
+
+/* Generator registers offset addresses inside the generator block */
+#define PWM_GEN_CTL_REG_OFFSET             0x00
+#define PWM_GEN_INTEN_REG_OFFSET           0x04
+#define PWM_GEN_RIS_REG_OFFSET             0x08
+#define PWM_GEN_ISC_REG_OFFSET             0x0C
+#define PWM_GEN_LOAD_REG_OFFSET            0x10
+#define PWM_GEN_COUNT_REG_OFFSET           0x14
+#define PWM_GEN_CMPA_REG_OFFSET            0x18
+#define PWM_GEN_CMPB_REG_OFFSET            0x1C
+#define PWM_GEN_GENA_REG_OFFSET            0x20
+#define PWM_GEN_GENB_REG_OFFSET            0x24
+
+/* RCC register fields of the PWM clock divider */
+#define PWM_RCC_USEPWMDIV_BIT              (1UL << 20)
+#define PWM_RCC_PWMDIV_POS                 17
+#define PWM_RCC_PWMDIV_MASK                (0x7UL << PWM_RCC_PWMDIV_POS)
+
+#endif /* PWM_REGS_H */
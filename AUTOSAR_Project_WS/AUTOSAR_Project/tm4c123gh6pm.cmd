@@ -34,6 +34,10 @@ SECTIONS
     .cinit  :   > FLASH
     .pinit  :   > FLASH
     .init_array : > FLASH
+    .binit  :   > FLASH
+
+    /* Functions declared with RAM_FUNC are stored in Flash and copied to SRAM by the boot code */
+    .TI.ramfunc : load = FLASH, run = SRAM, table(BINIT)
 
     .vtable :   > 0x20000000
     .data   :   > SRAM
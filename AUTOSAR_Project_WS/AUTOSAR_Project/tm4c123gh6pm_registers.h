@@ -142,6 +142,78 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+/*****************************************************************************
+16/32-bit Timer0 Registers
+*****************************************************************************/
+#define TIMER0_CFG_REG            (*((volatile uint32 *)0x40030000))
+#define TIMER0_TAMR_REG           (*((volatile uint32 *)0x40030004))
+#define TIMER0_CTL_REG            (*((volatile uint32 *)0x4003000C))
+#define TIMER0_IMR_REG            (*((volatile uint32 *)0x40030018))
+#define TIMER0_RIS_REG            (*((volatile uint32 *)0x4003001C))
+#define TIMER0_MIS_REG            (*((volatile uint32 *)0x40030020))
+#define TIMER0_ICR_REG            (*((volatile uint32 *)0x40030024))
+#define TIMER0_TAILR_REG          (*((volatile uint32 *)0x40030028))
+#define TIMER0_TAMATCHR_REG       (*((volatile uint32 *)0x40030030))
+#define TIMER0_TAPR_REG           (*((volatile uint32 *)0x40030038))
+#define TIMER0_TAR_REG            (*((volatile uint32 *)0x40030048))
+#define TIMER0_TAV_REG            (*((volatile uint32 *)0x40030050))
+
+/*****************************************************************************
+16/32-bit Timer1 Registers
+*****************************************************************************/
+#define TIMER1_CFG_REG            (*((volatile uint32 *)0x40031000))
+#define TIMER1_TAMR_REG           (*((volatile uint32 *)0x40031004))
+#define TIMER1_CTL_REG            (*((volatile uint32 *)0x4003100C))
+#define TIMER1_IMR_REG            (*((volatile uint32 *)0x40031018))
+#define TIMER1_RIS_REG            (*((volatile uint32 *)0x4003101C))
+#define TIMER1_MIS_REG            (*((volatile uint32 *)0x40031020))
+#define TIMER1_ICR_REG            (*((volatile uint32 *)0x40031024))
+#define TIMER1_TAILR_REG          (*((volatile uint32 *)0x40031028))
+#define TIMER1_TAR_REG            (*((volatile uint32 *)0x40031048))
+#define TIMER1_TAV_REG            (*((volatile uint32 *)0x40031050))
+
+/*****************************************************************************
+16/32-bit Timer2 Registers
+*****************************************************************************/
+#define TIMER2_CFG_REG            (*((volatile uint32 *)0x40032000))
+#define TIMER2_TAMR_REG           (*((volatile uint32 *)0x40032004))
+#define TIMER2_CTL_REG            (*((volatile uint32 *)0x4003200C))
+#define TIMER2_IMR_REG            (*((volatile uint32 *)0x40032018))
+#define TIMER2_RIS_REG            (*((volatile uint32 *)0x4003201C))
+#define TIMER2_MIS_REG            (*((volatile uint32 *)0x40032020))
+#define TIMER2_ICR_REG            (*((volatile uint32 *)0x40032024))
+#define TIMER2_TAILR_REG          (*((volatile uint32 *)0x40032028))
+#define TIMER2_TAR_REG            (*((volatile uint32 *)0x40032048))
+#define TIMER2_TAV_REG            (*((volatile uint32 *)0x40032050))
+
+/*****************************************************************************
+16/32-bit Timer3 Registers
+*****************************************************************************/
+#define TIMER3_CFG_REG            (*((volatile uint32 *)0x40033000))
+#define TIMER3_TAMR_REG           (*((volatile uint32 *)0x40033004))
+#define TIMER3_CTL_REG            (*((volatile uint32 *)0x4003300C))
+#define TIMER3_IMR_REG            (*((volatile uint32 *)0x40033018))
+#define TIMER3_RIS_REG            (*((volatile uint32 *)0x4003301C))
+#define TIMER3_MIS_REG            (*((volatile uint32 *)0x40033020))
+#define TIMER3_ICR_REG            (*((volatile uint32 *)0x40033024))
+#define TIMER3_TAILR_REG          (*((volatile uint32 *)0x40033028))
+#define TIMER3_TAR_REG            (*((volatile uint32 *)0x40033048))
+#define TIMER3_TAV_REG            (*((volatile uint32 *)0x40033050))
+
+/*****************************************************************************
+16/32-bit Timer4 Registers
+*****************************************************************************/
+#define TIMER4_CFG_REG            (*((volatile uint32 *)0x40034000))
+#define TIMER4_TAMR_REG           (*((volatile uint32 *)0x40034004))
+#define TIMER4_CTL_REG            (*((volatile uint32 *)0x4003400C))
+#define TIMER4_IMR_REG            (*((volatile uint32 *)0x40034018))
+#define TIMER4_RIS_REG            (*((volatile uint32 *)0x4003401C))
+#define TIMER4_MIS_REG            (*((volatile uint32 *)0x40034020))
+#define TIMER4_ICR_REG            (*((volatile uint32 *)0x40034024))
+#define TIMER4_TAILR_REG          (*((volatile uint32 *)0x40034028))
+#define TIMER4_TAR_REG            (*((volatile uint32 *)0x40034048))
+#define TIMER4_TAV_REG            (*((volatile uint32 *)0x40034050))
+
 /*****************************************************************************
 NVIC Registers
 *****************************************************************************/
@@ -201,6 +273,9 @@ System Control Block Registers
 #define NVIC_SYSTEM_SYSHNDCTRL    (*((volatile uint32 *)0xE000ED24))
 #define NVIC_SYSTEM_INTCTRL       (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_CFGCTRL       (*((volatile uint32 *)0xE000ED14))
+#define NVIC_SYSTEM_SYSCTRL       (*((volatile uint32 *)0xE000ED10))
+#define NVIC_SYSTEM_VTABLE        (*((volatile uint32 *)0xE000ED08))
+#define NVIC_SYSTEM_APINT         (*((volatile uint32 *)0xE000ED0C))
 
 /*****************************************************************************
 MPU Registers